@@ -49,7 +49,7 @@ bool CAttack::Attack(LPOBJ lpObj, LPOBJ lpTarget, CSkill* lpSkill, bool send, in
 		return false;
 	}
 
-	if (gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) != 0 || gMap[lpTarget->Map].CheckAttr(lpTarget->X, lpTarget->Y, 1) != 0)
+	if (gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) != 0 || gMap[lpTarget->Map].CheckSafeAttr(lpTarget->X, lpTarget->Y) != 0)
 	{
 		return false;
 	}
@@ -1290,7 +1290,7 @@ void CAttack::CGAttackRecv(PMSG_ATTACK_RECV* lpMsg, int aIndex)
 		return;
 	}
 
-	if (gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) != false || gMap[lpTarget->Map].CheckAttr(lpTarget->X, lpTarget->Y, 1) != false)
+	if (gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) != false || gMap[lpTarget->Map].CheckSafeAttr(lpTarget->X, lpTarget->Y) != false)
 	{
 		return;
 	}
@@ -38,6 +38,8 @@ CBonusManager::CBonusManager()
 
 		lpInfo->ValueInfo.clear();
 	}
+
+	this->m_BonusValueDirty = 0;
 }
 
 CBonusManager::~CBonusManager()
@@ -58,6 +60,8 @@ void CBonusManager::Init()
 			this->SetState(&this->m_BonusInfo[n], BONUS_STATE_EMPTY);
 		}
 	}
+
+	this->MakeBonusValueTable();
 }
 
 void CBonusManager::Load(const char* path)
@@ -206,6 +210,8 @@ void CBonusManager::Load(const char* path)
 		ErrorMessageBox(lpReadScript->GetError());
 	}
 
+	this->MakeBonusValueTable();
+
 	delete lpReadScript;
 }
 
@@ -248,6 +254,11 @@ void CBonusManager::MainProc()
 			}
 		}
 	}
+
+	if (this->m_BonusValueDirty != 0)
+	{
+		this->MakeBonusValueTable();
+	}
 }
 
 void CBonusManager::ProcState_BLANK(BONUS_INFO* lpInfo)
@@ -300,7 +311,11 @@ void CBonusManager::ProcState_START(BONUS_INFO* lpInfo)
 
 void CBonusManager::SetState(BONUS_INFO* lpInfo, int state)
 {
-	switch ((lpInfo->State = state))
+	lpInfo->State = state;
+
+	this->m_BonusValueDirty = 1;
+
+	switch (lpInfo->State)
 	{
 		case BONUS_STATE_BLANK:
 		{
@@ -439,56 +454,63 @@ int CBonusManager::GetRemainTime(int index)
 
 int CBonusManager::GetBonusValue(LPOBJ lpObj, int BonusIndex, int BonusValue, int ItemIndex, int ItemLevel, int MonsterClass, int MonsterLevel)
 {
-	for (int n = 0; n < MAX_BONUS; n++)
+	if (CHECK_RANGE(BonusIndex, MAX_BONUS_INDEX) == 0 || CHECK_RANGE(lpObj->Map, MAX_MAP) == 0)
 	{
-		if (this->m_BonusInfo[n].State == BONUS_STATE_START)
+		return BonusValue;
+	}
+
+	this->m_BonusValueCritical.lock();
+
+	std::vector<BONUS_VALUE_INFO>* lpTable = &this->m_BonusValueTable[BonusIndex][lpObj->Map];
+
+	for (std::vector<BONUS_VALUE_INFO>::iterator it = lpTable->begin(); it != lpTable->end(); it++)
+	{
+		BONUS_VALUE_INFO* lpValue = &(*it);
+
+		if ((lpValue->ItemIndex == -1 || lpValue->ItemIndex == ItemIndex) && (lpValue->ItemLevel == -1 || lpValue->ItemLevel == ItemLevel) && (lpValue->MonsterClass == -1 || lpValue->MonsterClass == MonsterClass) && (lpValue->MonsterLevelMin == -1 || lpValue->MonsterLevelMin <= MonsterLevel) && (lpValue->MonsterLevelMax == -1 || lpValue->MonsterLevelMax >= MonsterLevel))
 		{
-			for (std::vector<BONUS_VALUE_INFO>::iterator it = this->m_BonusInfo[n].ValueInfo.begin(); it != this->m_BonusInfo[n].ValueInfo.end(); it++)
+			switch (lpValue->BonusIndex)
 			{
-				if (it->BonusIndex == BonusIndex && (it->ItemIndex == -1 || it->ItemIndex == ItemIndex) && (it->ItemLevel == -1 || it->ItemLevel == ItemLevel) && (it->MapNumber == -1 || it->MapNumber == lpObj->Map) && (it->MonsterClass == -1 || it->MonsterClass == MonsterClass) && (it->MonsterLevelMin == -1 || it->MonsterLevelMin <= MonsterLevel) && (it->MonsterLevelMax == -1 || it->MonsterLevelMax >= MonsterLevel))
+				case BONUS_INDEX_EXPERIENCE_RATE:
 				{
-					switch (it->BonusIndex)
-					{
-						case BONUS_INDEX_EXPERIENCE_RATE:
-						{
-							BonusValue += (BonusValue * it->BonusValue[lpObj->AccountLevel]) / 100;
+					BonusValue += (BonusValue * lpValue->BonusValue[lpObj->AccountLevel]) / 100;
 
-							break;
-						}
+					break;
+				}
 
-						case BONUS_INDEX_ITEM_DROP_RATE:
-						{
-							BonusValue += (BonusValue * it->BonusValue[lpObj->AccountLevel]) / 100;
+				case BONUS_INDEX_ITEM_DROP_RATE:
+				{
+					BonusValue += (BonusValue * lpValue->BonusValue[lpObj->AccountLevel]) / 100;
 
-							break;
-						}
+					break;
+				}
 
-						case BONUS_INDEX_CMN_ITEM_DROP_RATE:
-						{
-							BonusValue += ((__int64)(1000000 - BonusValue) * it->BonusValue[lpObj->AccountLevel]) / 1000000;
+				case BONUS_INDEX_CMN_ITEM_DROP_RATE:
+				{
+					BonusValue += ((__int64)(1000000 - BonusValue) * lpValue->BonusValue[lpObj->AccountLevel]) / 1000000;
 
-							break;
-						}
+					break;
+				}
 
-						case BONUS_INDEX_EXC_ITEM_DROP_RATE:
-						{
-							BonusValue += ((__int64)(1000000 - BonusValue) * it->BonusValue[lpObj->AccountLevel]) / 1000000;
+				case BONUS_INDEX_EXC_ITEM_DROP_RATE:
+				{
+					BonusValue += ((__int64)(1000000 - BonusValue) * lpValue->BonusValue[lpObj->AccountLevel]) / 1000000;
 
-							break;
-						}
+					break;
+				}
 
-						case BONUS_INDEX_RESET_AMOUNT:
-						{
-							BonusValue += it->BonusValue[lpObj->AccountLevel];
+				case BONUS_INDEX_RESET_AMOUNT:
+				{
+					BonusValue += lpValue->BonusValue[lpObj->AccountLevel];
 
-							break;
-						}
-					}
+					break;
 				}
 			}
 		}
 	}
 
+	this->m_BonusValueCritical.unlock();
+
 	return BonusValue;
 }
 
@@ -534,3 +556,48 @@ void CBonusManager::StartBonus(int BonusIndex)
 	this->Init();
 }
 
+void CBonusManager::MakeBonusValueTable()
+{
+	// The rules are copied into a local table first, so GetBonusValue only
+	// waits for the swap and never sees ValueInfo while Load refills it.
+
+	std::vector<BONUS_VALUE_INFO> BonusValueTable[MAX_BONUS_INDEX][MAX_MAP];
+
+	this->m_BonusValueDirty = 0;
+
+	for (int n = 0; n < MAX_BONUS; n++)
+	{
+		if (this->m_BonusInfo[n].State != BONUS_STATE_START)
+		{
+			continue;
+		}
+
+		for (std::vector<BONUS_VALUE_INFO>::iterator it = this->m_BonusInfo[n].ValueInfo.begin(); it != this->m_BonusInfo[n].ValueInfo.end(); it++)
+		{
+			if (CHECK_RANGE(it->BonusIndex, MAX_BONUS_INDEX) == 0)
+			{
+				continue;
+			}
+
+			for (int i = 0; i < MAX_MAP; i++)
+			{
+				if (it->MapNumber == -1 || it->MapNumber == i)
+				{
+					BonusValueTable[it->BonusIndex][i].push_back((*it));
+				}
+			}
+		}
+	}
+
+	this->m_BonusValueCritical.lock();
+
+	for (int n = 0; n < MAX_BONUS_INDEX; n++)
+	{
+		for (int i = 0; i < MAX_MAP; i++)
+		{
+			this->m_BonusValueTable[n][i].swap(BonusValueTable[n][i]);
+		}
+	}
+
+	this->m_BonusValueCritical.unlock();
+}
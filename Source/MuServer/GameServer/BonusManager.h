@@ -1,8 +1,11 @@
 #pragma once
 
+#include "CriticalSection.h"
+#include "Map.h"
 #include "User.h"
 
 #define MAX_BONUS 30
+#define MAX_BONUS_INDEX 6
 
 enum eBonusState
 {
@@ -104,9 +107,19 @@ public:
 
 	void StartBonus(int BonusIndex);
 
+private:
+
+	void MakeBonusValueTable();
+
 private:
 
 	BONUS_INFO m_BonusInfo[MAX_BONUS];
+
+	std::vector<BONUS_VALUE_INFO> m_BonusValueTable[MAX_BONUS_INDEX][MAX_MAP];
+
+	bool m_BonusValueDirty;
+
+	CCriticalSection m_BonusValueCritical;
 };
 
 extern CBonusManager gBonusManager;
@@ -103,7 +103,7 @@ void CChaosBox::GCChaosBoxSend(LPOBJ lpObj)
 
 		info.slot = n;
 
-		gItemManager.ItemByteConvert(info.ItemInfo, lpObj->ChaosBox[n]);
+		gItemManager.ItemByteConvert(info.ItemInfo, &lpObj->ChaosBox[n]);
 
 		memcpy(&send[size], &info, sizeof(info));
 
@@ -264,7 +264,7 @@ void CChaosBox::GCChaosMixSend(int aIndex, BYTE result, CItem* lpItem)
 	}
 	else
 	{
-		gItemManager.ItemByteConvert(pMsg.ItemInfo, (*lpItem));
+		gItemManager.ItemByteConvert(pMsg.ItemInfo, lpItem);
 	}
 
 	DataSend(aIndex, (BYTE*)&pMsg, pMsg.header.size);
@@ -147,12 +147,12 @@ void CCommandManager::MainProc()
 			continue;
 		}
 
-		if (gObj[n].AutoAddPointCount > 0)
+		if (gObj[n].UserData->AutoAddPointCount > 0)
 		{
 			this->CommandAddPointAutoProc(&gObj[n]);
 		}
 
-		if (gObj[n].AutoResetEnable != 0)
+		if (gObj[n].UserData->AutoResetEnable != 0)
 		{
 			this->CommandResetAutoProc(&gObj[n]);
 		}
@@ -291,7 +291,7 @@ bool CCommandManager::ManagementCore(LPOBJ lpObj, char* message)
 		return false;
 	}
 
-	DWORD tick = (GetTickCount() - lpObj->CommandLastTick[CommandData.Index]) / 1000;
+	DWORD tick = (GetTickCount() - lpObj->UserData->CommandLastTick[CommandData.Index]) / 1000;
 
 	if (tick < (DWORD)CommandData.Delay)
 	{
@@ -532,18 +532,18 @@ bool CCommandManager::ManagementCore(LPOBJ lpObj, char* message)
 
 	GCMoneySend(lpObj->Index, lpObj->Money);
 
-	lpObj->CommandLastTick[CommandData.Index] = GetTickCount();
+	lpObj->UserData->CommandLastTick[CommandData.Index] = GetTickCount();
 
 	return true;
 }
 
 void CCommandManager::CommandMove(LPOBJ lpObj, char* arg)
 {
-	MOVE_INFO MoveInfo;
+	MOVE_INFO* lpMoveInfo = gMove.GetInfoByName(arg);
 
-	if (gMove.GetInfoByName(arg, &MoveInfo) != 0)
+	if (lpMoveInfo != 0)
 	{
-		gMove.Move(lpObj, MoveInfo.Index);
+		gMove.Move(lpObj, lpMoveInfo->Index);
 	}
 }
 
@@ -800,17 +800,17 @@ void CCommandManager::CommandAddPointAuto(LPOBJ lpObj, char* arg, int type)
 
 	if (amount > 0)
 	{
-		lpObj->AutoAddPointCount = 0;
+		lpObj->UserData->AutoAddPointCount = 0;
 
-		lpObj->AutoAddPointStats[type] = amount;
+		lpObj->UserData->AutoAddPointStats[type] = amount;
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[0] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[0] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[1] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[1] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[2] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[2] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[3] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[3] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(73, lpObj->Lang), amount);
 
@@ -818,17 +818,17 @@ void CCommandManager::CommandAddPointAuto(LPOBJ lpObj, char* arg, int type)
 	}
 	else
 	{
-		lpObj->AutoAddPointCount = 0;
+		lpObj->UserData->AutoAddPointCount = 0;
 
-		lpObj->AutoAddPointStats[type] = 0;
+		lpObj->UserData->AutoAddPointStats[type] = 0;
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[0] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[0] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[1] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[1] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[2] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[2] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-		lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[3] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+		lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[3] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(74, lpObj->Lang));
 	}
@@ -836,18 +836,18 @@ void CCommandManager::CommandAddPointAuto(LPOBJ lpObj, char* arg, int type)
 
 void CCommandManager::CommandAddPointAutoProc(LPOBJ lpObj)
 {
-	if (lpObj->LevelUpPoint == 0 || lpObj->AutoAddPointCount == 0)
+	if (lpObj->LevelUpPoint == 0 || lpObj->UserData->AutoAddPointCount == 0)
 	{
 		return;
 	}
 
-	int AddStatCount = lpObj->AutoAddPointCount;
+	int AddStatCount = lpObj->UserData->AutoAddPointCount;
 
 	int* stat[4] = { &lpObj->Strength, &lpObj->Dexterity, &lpObj->Vitality, &lpObj->Energy };
 
 	for (int n = 0; n < 4; n++)
 	{
-		if (lpObj->AutoAddPointStats[n] > 0)
+		if (lpObj->UserData->AutoAddPointStats[n] > 0)
 		{
 			if (AddStatCount == 0)
 			{
@@ -858,7 +858,7 @@ void CCommandManager::CommandAddPointAutoProc(LPOBJ lpObj)
 
 			AddStat = (((lpObj->LevelUpPoint % AddStatCount) > 0) ? (AddStat + 1) : AddStat);
 
-			AddStat = ((AddStat > lpObj->AutoAddPointStats[n]) ? lpObj->AutoAddPointStats[n] : AddStat);
+			AddStat = ((AddStat > lpObj->UserData->AutoAddPointStats[n]) ? lpObj->UserData->AutoAddPointStats[n] : AddStat);
 
 			AddStat = ((((*stat[n]) + AddStat) > gServerInfo.m_MaxStatPoint[lpObj->AccountLevel]) ? (gServerInfo.m_MaxStatPoint[lpObj->AccountLevel] - (*stat[n])) : AddStat);
 
@@ -868,17 +868,17 @@ void CCommandManager::CommandAddPointAutoProc(LPOBJ lpObj)
 
 			lpObj->LevelUpPoint -= AddStat;
 
-			lpObj->AutoAddPointStats[n] -= (((*stat[n]) >= gServerInfo.m_MaxStatPoint[lpObj->AccountLevel]) ? lpObj->AutoAddPointStats[n] : AddStat);
+			lpObj->UserData->AutoAddPointStats[n] -= (((*stat[n]) >= gServerInfo.m_MaxStatPoint[lpObj->AccountLevel]) ? lpObj->UserData->AutoAddPointStats[n] : AddStat);
 
-			lpObj->AutoAddPointCount = 0;
+			lpObj->UserData->AutoAddPointCount = 0;
 
-			lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[0] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+			lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[0] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-			lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[1] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+			lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[1] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-			lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[2] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+			lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[2] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-			lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[3] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+			lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[3] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 		}
 	}
 
@@ -941,7 +941,7 @@ void CCommandManager::CommandReset(LPOBJ lpObj, char* arg)
 		}
 	}
 
-	if (((lpObj->CommandManagerTransaction == 0) ? (lpObj->CommandManagerTransaction++) : lpObj->CommandManagerTransaction) != 0)
+	if (((lpObj->UserData->CommandManagerTransaction == 0) ? (lpObj->UserData->CommandManagerTransaction++) : lpObj->UserData->CommandManagerTransaction) != 0)
 	{
 		return;
 	}
@@ -968,31 +968,31 @@ void CCommandManager::CommandResetAuto(LPOBJ lpObj, char* arg)
 		return;
 	}
 
-	if (lpObj->AutoResetEnable == 0)
+	if (lpObj->UserData->AutoResetEnable == 0)
 	{
-		lpObj->AutoResetEnable = 1;
+		lpObj->UserData->AutoResetEnable = 1;
 
-		lpObj->AutoResetStats[0] = this->GetNumber(arg, 1);
+		lpObj->UserData->AutoResetStats[0] = this->GetNumber(arg, 1);
 
-		lpObj->AutoResetStats[1] = this->GetNumber(arg, 2);
+		lpObj->UserData->AutoResetStats[1] = this->GetNumber(arg, 2);
 
-		lpObj->AutoResetStats[2] = this->GetNumber(arg, 3);
+		lpObj->UserData->AutoResetStats[2] = this->GetNumber(arg, 3);
 
-		lpObj->AutoResetStats[3] = this->GetNumber(arg, 4);
+		lpObj->UserData->AutoResetStats[3] = this->GetNumber(arg, 4);
 
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(82, lpObj->Lang));
 	}
 	else
 	{
-		lpObj->AutoResetEnable = 0;
+		lpObj->UserData->AutoResetEnable = 0;
 
-		lpObj->AutoResetStats[0] = 0;
+		lpObj->UserData->AutoResetStats[0] = 0;
 
-		lpObj->AutoResetStats[1] = 0;
+		lpObj->UserData->AutoResetStats[1] = 0;
 
-		lpObj->AutoResetStats[2] = 0;
+		lpObj->UserData->AutoResetStats[2] = 0;
 
-		lpObj->AutoResetStats[3] = 0;
+		lpObj->UserData->AutoResetStats[3] = 0;
 
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(83, lpObj->Lang));
 	}
@@ -1037,7 +1037,7 @@ void CCommandManager::CommandResetAutoProc(LPOBJ lpObj)
 		}
 	}
 
-	if (((lpObj->CommandManagerTransaction == 0) ? (lpObj->CommandManagerTransaction++) : lpObj->CommandManagerTransaction) != 0)
+	if (((lpObj->UserData->CommandManagerTransaction == 0) ? (lpObj->UserData->CommandManagerTransaction++) : lpObj->UserData->CommandManagerTransaction) != 0)
 	{
 		return;
 	}
@@ -1068,7 +1068,7 @@ void CCommandManager::DGCommandResetRecv(SDHP_COMMAND_RESET_RECV* lpMsg)
 
 	LPOBJ lpObj = &gObj[lpMsg->index];
 
-	lpObj->CommandManagerTransaction = 0;
+	lpObj->UserData->CommandManagerTransaction = 0;
 
 	if (lpMsg->ResetDay >= ((DWORD)gServerInfo.m_CommandResetLimitDay[lpObj->AccountLevel]))
 	{
@@ -1107,15 +1107,15 @@ void CCommandManager::DGCommandResetRecv(SDHP_COMMAND_RESET_RECV* lpMsg)
 
 	lpMsg->ResetMon += gBonusManager.GetBonusValue(lpObj, BONUS_INDEX_RESET_AMOUNT, gServerInfo.m_CommandResetCount[lpObj->AccountLevel], -1, -1, -1, -1);
 
-	lpObj->AutoAddPointCount = 0;
+	lpObj->UserData->AutoAddPointCount = 0;
 
-	lpObj->AutoAddPointStats[0] = 0;
+	lpObj->UserData->AutoAddPointStats[0] = 0;
 
-	lpObj->AutoAddPointStats[1] = 0;
+	lpObj->UserData->AutoAddPointStats[1] = 0;
 
-	lpObj->AutoAddPointStats[2] = 0;
+	lpObj->UserData->AutoAddPointStats[2] = 0;
 
-	lpObj->AutoAddPointStats[3] = 0;
+	lpObj->UserData->AutoAddPointStats[3] = 0;
 
 	if (gServerInfo.m_CommandResetQuest[lpObj->AccountLevel] != 0)
 	{
@@ -1133,7 +1133,7 @@ void CCommandManager::DGCommandResetRecv(SDHP_COMMAND_RESET_RECV* lpMsg)
 
 		gQuest.GCQuestRewardSend(lpObj->Index, 201, Class);
 
-		memset(lpObj->Quest, 0xFF, sizeof(lpObj->Quest));
+		memset(lpObj->UserData->Quest, 0xFF, sizeof(lpObj->UserData->Quest));
 
 		gQuest.GCQuestInfoSend(lpObj->Index);
 	}
@@ -1247,21 +1247,21 @@ void CCommandManager::DGCommandResetRecv(SDHP_COMMAND_RESET_RECV* lpMsg)
 		}
 	}
 
-	lpObj->AutoAddPointStats[0] = lpObj->AutoResetStats[0];
+	lpObj->UserData->AutoAddPointStats[0] = lpObj->UserData->AutoResetStats[0];
 
-	lpObj->AutoAddPointStats[1] = lpObj->AutoResetStats[1];
+	lpObj->UserData->AutoAddPointStats[1] = lpObj->UserData->AutoResetStats[1];
 
-	lpObj->AutoAddPointStats[2] = lpObj->AutoResetStats[2];
+	lpObj->UserData->AutoAddPointStats[2] = lpObj->UserData->AutoResetStats[2];
 
-	lpObj->AutoAddPointStats[3] = lpObj->AutoResetStats[3];
+	lpObj->UserData->AutoAddPointStats[3] = lpObj->UserData->AutoResetStats[3];
 
-	lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[0] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+	lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[0] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-	lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[1] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+	lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[1] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-	lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[2] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+	lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[2] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
-	lpObj->AutoAddPointCount = ((lpObj->AutoAddPointStats[3] > 0) ? (lpObj->AutoAddPointCount + 1) : lpObj->AutoAddPointCount);
+	lpObj->UserData->AutoAddPointCount = ((lpObj->UserData->AutoAddPointStats[3] > 0) ? (lpObj->UserData->AutoAddPointCount + 1) : lpObj->UserData->AutoAddPointCount);
 
 	this->CommandAddPointAutoProc(lpObj);
 
@@ -1318,7 +1318,7 @@ void CCommandManager::CommandGrandReset(LPOBJ lpObj, char* arg)
 		}
 	}
 
-	if (((lpObj->CommandManagerTransaction == 0) ? (lpObj->CommandManagerTransaction++) : lpObj->CommandManagerTransaction) != 0)
+	if (((lpObj->UserData->CommandManagerTransaction == 0) ? (lpObj->UserData->CommandManagerTransaction++) : lpObj->UserData->CommandManagerTransaction) != 0)
 	{
 		return;
 	}
@@ -1349,7 +1349,7 @@ void CCommandManager::DGCommandGrandResetRecv(SDHP_COMMAND_RESET_RECV* lpMsg)
 
 	LPOBJ lpObj = &gObj[lpMsg->index];
 
-	lpObj->CommandManagerTransaction = 0;
+	lpObj->UserData->CommandManagerTransaction = 0;
 
 	if (lpMsg->ResetDay >= ((DWORD)gServerInfo.m_CommandGrandResetLimitDay[lpObj->AccountLevel]))
 	{
@@ -1406,7 +1406,7 @@ void CCommandManager::DGCommandGrandResetRecv(SDHP_COMMAND_RESET_RECV* lpMsg)
 
 		gQuest.GCQuestRewardSend(lpObj->Index, 201, Class);
 
-		memset(lpObj->Quest, 0xFF, sizeof(lpObj->Quest));
+		memset(lpObj->UserData->Quest, 0xFF, sizeof(lpObj->UserData->Quest));
 
 		gQuest.GCQuestInfoSend(lpObj->Index);
 	}
@@ -1586,7 +1586,7 @@ void CCommandManager::CommandChange(LPOBJ lpObj, char* arg)
 		}
 	}
 
-	lpObj->SendQuestInfo = 0;
+	lpObj->UserData->SendQuestInfo = 0;
 
 	gQuest.GCQuestInfoSend(lpObj->Index);
 
@@ -1696,7 +1696,7 @@ void CCommandManager::CommandRequest(LPOBJ lpObj, char* arg)
 
 		lpObj->Option &= ~4;
 
-		memset(lpObj->AutoPartyPassword, 0, sizeof(lpObj->AutoPartyPassword));
+		memset(lpObj->UserData->AutoPartyPassword, 0, sizeof(lpObj->UserData->AutoPartyPassword));
 
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(103, lpObj->Lang));
 	}
@@ -1708,7 +1708,7 @@ void CCommandManager::CommandRequest(LPOBJ lpObj, char* arg)
 
 		lpObj->Option &= ~4;
 
-		memset(lpObj->AutoPartyPassword, 0, sizeof(lpObj->AutoPartyPassword));
+		memset(lpObj->UserData->AutoPartyPassword, 0, sizeof(lpObj->UserData->AutoPartyPassword));
 
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(104, lpObj->Lang));
 	}
@@ -1720,9 +1720,9 @@ void CCommandManager::CommandRequest(LPOBJ lpObj, char* arg)
 
 		lpObj->Option |= 4;
 
-		memset(lpObj->AutoPartyPassword, 0, sizeof(lpObj->AutoPartyPassword));
+		memset(lpObj->UserData->AutoPartyPassword, 0, sizeof(lpObj->UserData->AutoPartyPassword));
 
-		this->GetString(arg, lpObj->AutoPartyPassword, sizeof(lpObj->AutoPartyPassword), 1);
+		this->GetString(arg, lpObj->UserData->AutoPartyPassword, sizeof(lpObj->UserData->AutoPartyPassword), 1);
 
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(105, lpObj->Lang));
 	}
@@ -730,7 +730,7 @@ void DGCharacterInfoRecv(SDHP_CHARACTER_INFO_RECV* lpMsg)
 
 	gNotice.GCNoticeSend(lpObj->Index, 0, gMessage.GetTextMessage(41, lpObj->Lang), lpObj->Name);
 
-	gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage((36 + lpObj->AccountLevel), lpObj->Lang), lpObj->AccountExpireDate);
+	gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage((36 + lpObj->AccountLevel), lpObj->Lang), lpObj->UserData->AccountExpireDate);
 
 	gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(40, lpObj->Lang), lpObj->Reset, lpObj->GrandReset);
 
@@ -807,7 +807,7 @@ void GDCharacterInfoSaveSend(int aIndex)
 
 	pMsg.PKTime = lpObj->PKTime;
 
-	memcpy(pMsg.Quest, lpObj->Quest, sizeof(pMsg.Quest));
+	memcpy(pMsg.Quest, lpObj->UserData->Quest, sizeof(pMsg.Quest));
 
 	pMsg.FruitAddPoint = lpObj->FruitAddPoint;
 
@@ -34,6 +34,10 @@ void CEffect::Clear()
 	this->m_value[2] = 0;
 
 	this->m_value[3] = 0;
+
+	this->m_expire = 0;
+
+	this->m_serial = 0;
 }
 
 bool CEffect::IsEffect()
@@ -31,4 +31,8 @@ public:
 	DWORD m_count;
 
 	WORD m_value[4];
+
+	DWORD m_expire;
+
+	DWORD m_serial;
 };
\ No newline at end of file
@@ -3,11 +3,16 @@
 #include "ReadScript.h"
 #include "ObjectManager.h"
 #include "Util.h"
+#include "Viewport.h"
 
 CEffectManager gEffectManager;
 
 CEffectManager::CEffectManager()
 {
+	this->m_EffectTick = 0;
+
+	this->m_EffectSerial = 0;
+
 	this->Init();
 }
 
@@ -143,37 +148,64 @@ EFFECT_INFO* CEffectManager::GetInfoByItem(int ItemIndex)
 
 void CEffectManager::MainProc()
 {
-	for (int n = 0; n < MAX_OBJECT; n++)
+	std::vector<EFFECT_WHEEL_INFO> WheelList;
+
+	std::vector<EFFECT_WHEEL_INFO> EffectList;
+
+	this->m_critical.lock();
+
+	this->m_EffectTick++;
+
+	WheelList.swap(this->m_EffectWheel[this->m_EffectTick % MAX_EFFECT_WHEEL]);
+
+	for (std::vector<EFFECT_WHEEL_INFO>::iterator it = WheelList.begin(); it != WheelList.end(); it++)
 	{
-		if (gObjIsConnected(n) == false)
+		if (((int)(it->Deadline - this->m_EffectTick)) > 0)
+		{
+			this->m_EffectWheel[this->m_EffectTick % MAX_EFFECT_WHEEL].push_back((*it));
+		}
+		else
+		{
+			EffectList.push_back((*it));
+		}
+	}
+
+	this->m_critical.unlock();
+
+	for (std::vector<EFFECT_WHEEL_INFO>::iterator it = EffectList.begin(); it != EffectList.end(); it++)
+	{
+		if (gObjIsConnected(it->Index) == false)
 		{
 			continue;
 		}
 
-		LPOBJ lpObj = &gObj[n];
+		LPOBJ lpObj = &gObj[it->Index];
 
-		for (int i = 0; i < MAX_EFFECT_LIST; i++)
+		CEffect* lpEffect = this->GetEffect(lpObj, it->Effect);
+
+		if (lpEffect == 0 || lpEffect->m_serial != it->Serial)
 		{
-			CEffect* lpEffect = &lpObj->Effect[i];
+			continue;
+		}
 
-			if (lpEffect->IsEffect() == false)
-			{
-				continue;
-			}
+		this->PeriodicEffect(lpObj, lpEffect);
 
-			if (((lpEffect->m_count == 0) ? 0 : (lpEffect->m_count--)) > 0)
-			{
-				this->PeriodicEffect(lpObj, lpEffect);
+		if (lpEffect->IsEffect() == false || lpEffect->m_serial != it->Serial)
+		{
+			continue;
+		}
 
-				if (lpEffect->m_count == 0)
-				{
-					this->RemoveEffect(lpObj, lpEffect);
+		if (this->GetEffectCount(lpEffect) == 0)
+		{
+			this->RemoveEffect(lpObj, lpEffect);
 
-					this->GCEffectStateSend(lpObj, 0, lpEffect->m_index);
+			this->GCEffectStateSend(lpObj, 0, lpEffect->m_index);
 
-					lpEffect->Clear();
-				}
-			}
+			lpEffect->Clear();
+		}
+		else
+		{
+			this->ScheduleEffect(lpObj, lpEffect);
 		}
 	}
 }
@@ -308,6 +340,11 @@ bool CEffectManager::DelEffectByGroup(LPOBJ lpObj, int group)
 
 CEffect* CEffectManager::GetEffect(LPOBJ lpObj, int index)
 {
+	if (this->CheckEffect(lpObj, index) == false)
+	{
+		return 0;
+	}
+
 	for (int n = 0; n < MAX_EFFECT_LIST; n++)
 	{
 		CEffect* lpEffect = &lpObj->Effect[n];
@@ -348,12 +385,12 @@ CEffect* CEffectManager::GetEffectByGroup(LPOBJ lpObj, int group)
 
 bool CEffectManager::CheckEffect(LPOBJ lpObj, int index)
 {
-	if (this->GetEffect(lpObj, index) != nullptr)
+	if (EFFECT_RANGE(index) == false)
 	{
-		return true;
+		return false;
 	}
 
-	return false;
+	return ((lpObj->EffectMask[index / 32] & (1 << (index % 32))) != 0);
 }
 
 bool CEffectManager::CheckEffectByGroup(LPOBJ lpObj, int group)
@@ -368,8 +405,20 @@ bool CEffectManager::CheckEffectByGroup(LPOBJ lpObj, int group)
 
 void CEffectManager::InsertEffect(LPOBJ lpObj, CEffect* lpEffect)
 {
+	lpObj->EffectMask[lpEffect->m_index / 32] |= (1 << (lpEffect->m_index % 32));
+
+	this->m_critical.lock();
+
+	lpEffect->m_expire = this->m_EffectTick + lpEffect->m_count;
+
+	this->ScheduleEffect(lpObj, lpEffect);
+
+	this->m_critical.unlock();
+
 	lpObj->ViewSkillState |= this->GetViewSkillState(lpEffect->m_index);
 
+	gViewport.ClearViewportRecord(lpObj);
+
 	switch (lpEffect->m_index)
 	{
 		case EFFECT_GREATER_DAMAGE:
@@ -454,8 +503,15 @@ void CEffectManager::InsertEffect(LPOBJ lpObj, CEffect* lpEffect)
 
 void CEffectManager::RemoveEffect(LPOBJ lpObj, CEffect* lpEffect)
 {
+	if (EFFECT_RANGE(lpEffect->m_index) != false)
+	{
+		lpObj->EffectMask[lpEffect->m_index / 32] &= ~(1 << (lpEffect->m_index % 32));
+	}
+
 	lpObj->ViewSkillState &= ~this->GetViewSkillState(lpEffect->m_index);
 
+	gViewport.ClearViewportRecord(lpObj);
+
 	switch (lpEffect->m_index)
 	{
 		case EFFECT_GREATER_DAMAGE:
@@ -583,13 +639,15 @@ void CEffectManager::EffectByteConvert(BYTE* lpMsg, CEffect* lpEffect)
 	}
 	else
 	{
-		lpMsg[1] = SET_NUMBERHB(SET_NUMBERHW(lpEffect->m_count));
+		DWORD count = this->GetEffectCount(lpEffect);
+
+		lpMsg[1] = SET_NUMBERHB(SET_NUMBERHW(count));
 
-		lpMsg[2] = SET_NUMBERLB(SET_NUMBERHW(lpEffect->m_count));
+		lpMsg[2] = SET_NUMBERLB(SET_NUMBERHW(count));
 
-		lpMsg[3] = SET_NUMBERHB(SET_NUMBERLW(lpEffect->m_count));
+		lpMsg[3] = SET_NUMBERHB(SET_NUMBERLW(count));
 
-		lpMsg[4] = SET_NUMBERLB(SET_NUMBERLW(lpEffect->m_count));
+		lpMsg[4] = SET_NUMBERLB(SET_NUMBERLW(count));
 	}
 
 	lpMsg[5] = SET_NUMBERHB(lpEffect->m_value[0]);
@@ -621,7 +679,7 @@ int CEffectManager::GeneratePartyEffectList(LPOBJ lpObj, BYTE* lpMsg, int* size)
 		{
 			info.effect = lpObj->Effect[n].m_index;
 
-			info.count = lpObj->Effect[n].m_count;
+			info.count = this->GetEffectCount(&lpObj->Effect[n]);
 
 			memcpy(&lpMsg[(*size)], &info, sizeof(info));
 
@@ -752,7 +810,7 @@ void CEffectManager::PeriodicEffect(LPOBJ lpObj, CEffect* lpEffect)
 		return;
 	}
 
-	if (lpEffect->m_value[1] == 0 || (lpEffect->m_count % lpEffect->m_value[1]) != 0)
+	if (lpEffect->m_value[1] == 0 || (this->GetEffectCount(lpEffect) % lpEffect->m_value[1]) != 0)
 	{
 		return;
 	}
@@ -812,6 +870,47 @@ void CEffectManager::PeriodicEffect(LPOBJ lpObj, CEffect* lpEffect)
 	}
 }
 
+DWORD CEffectManager::GetEffectCount(CEffect* lpEffect)
+{
+	if (lpEffect->m_count == 0)
+	{
+		return 0;
+	}
+
+	return (lpEffect->m_expire - this->m_EffectTick);
+}
+
+void CEffectManager::ScheduleEffect(LPOBJ lpObj, CEffect* lpEffect)
+{
+	if (lpEffect->m_count == 0)
+	{
+		return;
+	}
+
+	this->m_critical.lock();
+
+	EFFECT_WHEEL_INFO info;
+
+	info.Index = lpObj->Index;
+
+	info.Effect = lpEffect->m_index;
+
+	info.Deadline = lpEffect->m_expire;
+
+	if (lpEffect->m_index == EFFECT_POISON && lpEffect->m_value[1] != 0)
+	{
+		info.Deadline = this->m_EffectTick + 1 + ((lpEffect->m_expire - this->m_EffectTick - 1) % lpEffect->m_value[1]);
+	}
+
+	info.Serial = ++this->m_EffectSerial;
+
+	lpEffect->m_serial = info.Serial;
+
+	this->m_EffectWheel[info.Deadline % MAX_EFFECT_WHEEL].push_back(info);
+
+	this->m_critical.unlock();
+}
+
 void CEffectManager::GCEffectStateSend(LPOBJ lpObj, BYTE state, BYTE effect)
 {
 	PMSG_EFFECT_STATE_SEND pMsg;
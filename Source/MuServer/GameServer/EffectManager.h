@@ -1,11 +1,13 @@
 #pragma once
 
+#include "CriticalSection.h"
 #include "Effect.h"
 #include "Protocol.h"
 #include "User.h"
 
 #define MAX_EFFECT 71
 #define MAX_EFFECT_LIST 16
+#define MAX_EFFECT_WHEEL 64
 
 #define EFFECT_RANGE(x) (((x)<0)?false:((x)>=MAX_EFFECT)?false:true)
 
@@ -72,6 +74,14 @@ struct PMSG_PARTY_EFFECT_LIST
 //**********************************************//
 //**********************************************//
 
+struct EFFECT_WHEEL_INFO
+{
+	int Index;
+	BYTE Effect;
+	DWORD Deadline;
+	DWORD Serial;
+};
+
 struct EFFECT_INFO
 {
 	int Index;
@@ -139,11 +149,23 @@ public:
 
 	void PeriodicEffect(LPOBJ lpObj, CEffect* lpEffect);
 
+	DWORD GetEffectCount(CEffect* lpEffect);
+
+	void ScheduleEffect(LPOBJ lpObj, CEffect* lpEffect);
+
 	void GCEffectStateSend(LPOBJ lpObj, BYTE state, BYTE effect);
 
 private:
 
 	EFFECT_INFO m_EffectInfo[MAX_EFFECT];
+
+	std::vector<EFFECT_WHEEL_INFO> m_EffectWheel[MAX_EFFECT_WHEEL];
+
+	DWORD m_EffectTick;
+
+	DWORD m_EffectSerial;
+
+	CCriticalSection m_critical;
 };
 
 extern CEffectManager gEffectManager;
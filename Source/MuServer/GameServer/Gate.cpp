@@ -9,7 +9,10 @@ CGate gGate;
 
 CGate::CGate()
 {
-	this->m_GateInfo.clear();
+	for (int n = 0; n < MAX_GATE; n++)
+	{
+		this->m_GateInfo[n].Index = -1;
+	}
 }
 
 CGate::~CGate()
@@ -37,7 +40,10 @@ void CGate::Load(const char* path)
 		return;
 	}
 
-	this->m_GateInfo.clear();
+	for (int n = 0; n < MAX_GATE; n++)
+	{
+		this->m_GateInfo[n].Index = -1;
+	}
 
 	try
 	{
@@ -82,7 +88,17 @@ void CGate::Load(const char* path)
 
 			info.AccountLevel = lpReadScript->GetAsNumber();
 
-			this->m_GateInfo.insert(std::pair<int, GATE_INFO>(info.Index, info));
+			if (info.Index < 0 || info.Index >= MAX_GATE)
+			{
+				LogAdd(LOG_RED, "[Gate] Gate index %d out of range (0-%d)", info.Index, (MAX_GATE - 1));
+
+				continue;
+			}
+
+			if (this->m_GateInfo[info.Index].Index == -1)
+			{
+				this->m_GateInfo[info.Index] = info;
+			}
 		}
 	}
 	catch (...)
@@ -93,32 +109,31 @@ void CGate::Load(const char* path)
 	delete lpReadScript;
 }
 
-bool CGate::GetInfo(int index, GATE_INFO* lpInfo)
+GATE_INFO* CGate::GetInfo(int index)
 {
-	std::map<int, GATE_INFO>::iterator it = this->m_GateInfo.find(index);
-
-	if (it == this->m_GateInfo.end())
+	if (index < 0 || index >= MAX_GATE)
 	{
 		return 0;
 	}
-	else
-	{
-		(*lpInfo) = it->second;
 
-		return 1;
+	if (this->m_GateInfo[index].Index != index)
+	{
+		return 0;
 	}
+
+	return &this->m_GateInfo[index];
 }
 
 int CGate::GetGateMap(int index)
 {
-	GATE_INFO info;
+	GATE_INFO* lpInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &info) == 0)
+	if (lpInfo == 0)
 	{
 		return -1;
 	}
 
-	return info.Map;
+	return lpInfo->Map;
 }
 
 int CGate::GetMoveLevel(LPOBJ lpObj, int map, int level)
@@ -133,9 +148,9 @@ int CGate::GetMoveLevel(LPOBJ lpObj, int map, int level)
 
 bool CGate::IsGate(int index)
 {
-	GATE_INFO info;
+	GATE_INFO* lpInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &info) == 0)
+	if (lpInfo == 0)
 	{
 		return 0;
 	}
@@ -147,44 +162,44 @@ bool CGate::IsGate(int index)
 
 bool CGate::IsInGate(LPOBJ lpObj, int index)
 {
-	GATE_INFO info;
+	GATE_INFO* lpInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &info) == 0)
+	if (lpInfo == 0)
 	{
 		return 0;
 	}
 
-	if (lpObj->Map != info.Map)
+	if (lpObj->Map != lpInfo->Map)
 	{
 		return 0;
 	}
 
-	if (lpObj->X < (info.TX - 5) || lpObj->X >(info.TX + 5) || lpObj->Y < (info.TY - 5) || lpObj->Y >(info.TY + 5))
+	if (lpObj->X < (lpInfo->TX - 5) || lpObj->X >(lpInfo->TX + 5) || lpObj->Y < (lpInfo->TY - 5) || lpObj->Y >(lpInfo->TY + 5))
 	{
 		return 0;
 	}
 
-	if (info.MinLevel != -1 && lpObj->Level < this->GetMoveLevel(lpObj, info.Map, info.MinLevel))
+	if (lpInfo->MinLevel != -1 && lpObj->Level < this->GetMoveLevel(lpObj, lpInfo->Map, lpInfo->MinLevel))
 	{
 		return 0;
 	}
 
-	if (info.MaxLevel != -1 && lpObj->Level > info.MaxLevel)
+	if (lpInfo->MaxLevel != -1 && lpObj->Level > lpInfo->MaxLevel)
 	{
 		return 0;
 	}
 
-	if (info.MinReset != -1 && lpObj->Reset < info.MinReset)
+	if (lpInfo->MinReset != -1 && lpObj->Reset < lpInfo->MinReset)
 	{
 		return 0;
 	}
 
-	if (info.MaxReset != -1 && lpObj->Reset > info.MaxReset)
+	if (lpInfo->MaxReset != -1 && lpObj->Reset > lpInfo->MaxReset)
 	{
 		return 0;
 	}
 
-	if (lpObj->AccountLevel < info.AccountLevel)
+	if (lpObj->AccountLevel < lpInfo->AccountLevel)
 	{
 		return 0;
 	}
@@ -194,53 +209,58 @@ bool CGate::IsInGate(LPOBJ lpObj, int index)
 
 bool CGate::GetGate(int index, int* gate, int* map, int* x, int* y, int* dir, int* level)
 {
-	GATE_INFO info;
+	GATE_INFO* lpInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &info) == 0)
+	if (lpInfo == 0)
 	{
 		return 0;
 	}
 
-	if (info.TargetGate != 0 && this->GetInfo(info.TargetGate, &info) == 0)
+	if (lpInfo->TargetGate != 0)
 	{
-		return 0;
+		lpInfo = this->GetInfo(lpInfo->TargetGate);
+
+		if (lpInfo == 0)
+		{
+			return 0;
+		}
 	}
 
 	int px, py;
 
 	for (int n = 0; n < 50; n++)
 	{
-		if ((info.TX - info.X) > 0)
+		if ((lpInfo->TX - lpInfo->X) > 0)
 		{
-			px = info.X + (GetLargeRand() % (info.TX - info.X));
+			px = lpInfo->X + (GetLargeRand() % (lpInfo->TX - lpInfo->X));
 		}
 		else
 		{
-			px = info.X;
+			px = lpInfo->X;
 		}
 
-		if ((info.TY - info.Y) > 0)
+		if ((lpInfo->TY - lpInfo->Y) > 0)
 		{
-			py = info.Y + (GetLargeRand() % (info.TY - info.Y));
+			py = lpInfo->Y + (GetLargeRand() % (lpInfo->TY - lpInfo->Y));
 		}
 		else
 		{
-			py = info.Y;
+			py = lpInfo->Y;
 		}
 
-		if (gMap[info.Map].CheckAttr(px, py, 4) == 0 && gMap[info.Map].CheckAttr(px, py, 8) == 0)
+		if (gMap[lpInfo->Map].CheckWalkAttr(px, py) != 0)
 		{
-			(*gate) = info.Index;
+			(*gate) = lpInfo->Index;
 
-			(*map) = info.Map;
+			(*map) = lpInfo->Map;
 
 			(*x) = px;
 
 			(*y) = py;
 
-			(*dir) = info.Dir;
+			(*dir) = lpInfo->Dir;
 
-			(*level) = info.MinLevel;
+			(*level) = lpInfo->MinLevel;
 
 			return 1;
 		}
@@ -2,6 +2,8 @@
 
 #include "User.h"
 
+#define MAX_GATE 256
+
 struct GATE_INFO
 {
 	int Index;
@@ -30,7 +32,7 @@ public:
 
 	void Load(const char* path);
 
-	bool GetInfo(int index, GATE_INFO* lpInfo);
+	GATE_INFO* GetInfo(int index);
 
 	int GetGateMap(int index);
 
@@ -44,7 +46,7 @@ public:
 
 private:
 
-	std::map<int, GATE_INFO> m_GateInfo;
+	GATE_INFO m_GateInfo[MAX_GATE];
 };
 
 extern CGate gGate;
@@ -87,19 +87,19 @@ void CGoldenArcher::DGGoldenArcherGetValuesRecv(SDHP_GOLDEN_ARCHER_GET_VALUES_RE
 
 	LPOBJ lpObj = &gObj[lpMsg->index];
 
-	lpObj->ArcherCoinCount[GOLDEN_ARCHER_COIN_RENA] = lpMsg->count[GOLDEN_ARCHER_COIN_RENA];
+	lpObj->UserData->ArcherCoinCount[GOLDEN_ARCHER_COIN_RENA] = lpMsg->count[GOLDEN_ARCHER_COIN_RENA];
 
-	lpObj->ArcherCoinCount[GOLDEN_ARCHER_COIN_STONE] = lpMsg->count[GOLDEN_ARCHER_COIN_STONE];
+	lpObj->UserData->ArcherCoinCount[GOLDEN_ARCHER_COIN_STONE] = lpMsg->count[GOLDEN_ARCHER_COIN_STONE];
 
-	memcpy(lpObj->ArcherLuckyNumber, lpMsg->LuckyNumber, sizeof(lpObj->ArcherLuckyNumber));
+	memcpy(lpObj->UserData->ArcherLuckyNumber, lpMsg->LuckyNumber, sizeof(lpObj->UserData->ArcherLuckyNumber));
 
-	lpObj->RegisteredLuckyNumbers.clear();
+	lpObj->UserData->RegisteredLuckyNumbers.clear();
 
 	for (int i = 0; i < lpMsg->registered; i++)
 	{
 		LUCKY_NUMBERS_REGISTERED* lpInfo = (LUCKY_NUMBERS_REGISTERED*)(((BYTE*)lpMsg) + sizeof(SDHP_GOLDEN_ARCHER_GET_VALUES_RECV) + (sizeof(LUCKY_NUMBERS_REGISTERED) * i));
 
-		lpObj->RegisteredLuckyNumbers.push_back(lpInfo->LuckyNumber);
+		lpObj->UserData->RegisteredLuckyNumbers.push_back(lpInfo->LuckyNumber);
 	}
 
 	this->GCGoldenArcherInfoSend(lpMsg->index);
@@ -180,18 +180,18 @@ void CGoldenArcher::NpcGoldenArcherOpenSend(int aIndex, int Type)
 
 	if (Type == GOLDEN_ARCHER_RENA_COLLECTOR)
 	{
-		pMsg.Count = lpObj->ArcherCoinCount[GOLDEN_ARCHER_COIN_RENA];
+		pMsg.Count = lpObj->UserData->ArcherCoinCount[GOLDEN_ARCHER_COIN_RENA];
 	}
 	else if (Type == GOLDEN_ARCHER_STONE_COLLECTOR)
 	{
-		pMsg.Count = lpObj->ArcherCoinCount[GOLDEN_ARCHER_COIN_STONE];
+		pMsg.Count = lpObj->UserData->ArcherCoinCount[GOLDEN_ARCHER_COIN_STONE];
 	}
 	else
 	{
 		pMsg.Count = 0;
 	}
 
-	memcpy(pMsg.LuckyNumber, lpObj->ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
+	memcpy(pMsg.LuckyNumber, lpObj->UserData->ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
 
 	DataSend(lpObj->Index, (BYTE*)&pMsg, pMsg.header.size);
 }
@@ -212,7 +212,7 @@ void CGoldenArcher::NpcGoldenArcherListSend(int aIndex)
 
 	LUCKY_NUMBER_INFO info;
 
-	for (std::string Number : lpObj->RegisteredLuckyNumbers)
+	for (std::string Number : lpObj->UserData->RegisteredLuckyNumbers)
 	{
 		memcpy(info.LuckyNumber, Number.c_str(), sizeof(info.LuckyNumber));
 
@@ -268,9 +268,9 @@ void CGoldenArcher::CGGoldenArcherRegisterRecv(PMSG_GOLDEN_ARCHER_REGISTER_RECV*
 
 	gItemManager.DecreaseItemDur(lpObj, Slot, 1);
 
-	lpObj->ArcherCoinCount[lpMsg->Type]++;
+	lpObj->UserData->ArcherCoinCount[lpMsg->Type]++;
 
-	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->ArcherCoinCount[lpMsg->Type]);
+	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->UserData->ArcherCoinCount[lpMsg->Type]);
 
 	this->GDGoldenArcherSaveCoinSend(lpObj->Index);
 }
@@ -296,9 +296,9 @@ void CGoldenArcher::GDGoldenArcherSaveCoinSend(int aIndex)
 
 	memcpy(pMsg.account, gObj[aIndex].Account, sizeof(pMsg.account));
 
-	pMsg.count[GOLDEN_ARCHER_COIN_RENA] = gObj[aIndex].ArcherCoinCount[GOLDEN_ARCHER_COIN_RENA];
+	pMsg.count[GOLDEN_ARCHER_COIN_RENA] = gObj[aIndex].UserData->ArcherCoinCount[GOLDEN_ARCHER_COIN_RENA];
 
-	pMsg.count[GOLDEN_ARCHER_COIN_STONE] = gObj[aIndex].ArcherCoinCount[GOLDEN_ARCHER_COIN_STONE];
+	pMsg.count[GOLDEN_ARCHER_COIN_STONE] = gObj[aIndex].UserData->ArcherCoinCount[GOLDEN_ARCHER_COIN_STONE];
 
 	gDataServerConnection.DataSend((BYTE*)&pMsg, sizeof(pMsg));
 }
@@ -347,16 +347,16 @@ void CGoldenArcher::GoldenArcherExchangeRena(int aIndex, int Type, int Count)
 
 	LPOBJ lpObj = &gObj[aIndex];
 
-	if (lpObj->ArcherCoinCount[Type] < this->m_RenaExchangeRequiredCount[Count])
+	if (lpObj->UserData->ArcherCoinCount[Type] < this->m_RenaExchangeRequiredCount[Count])
 	{
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(28, lpObj->Lang), this->m_StoneExchangeRequiredCount[Count]);
 
 		return;
 	}
 
-	lpObj->ArcherCoinCount[Type] -= this->m_RenaExchangeRequiredCount[Count];
+	lpObj->UserData->ArcherCoinCount[Type] -= this->m_RenaExchangeRequiredCount[Count];
 
-	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->ArcherCoinCount[Type]);
+	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->UserData->ArcherCoinCount[Type]);
 
 	this->GCGoldenArcherCloseSend(lpObj->Index);
 
@@ -381,7 +381,7 @@ void CGoldenArcher::GoldenArcherExchangeStone(int aIndex, int Type, int Count)
 
 	LPOBJ lpObj = &gObj[aIndex];
 
-	if (lpObj->ArcherCoinCount[Type] < this->m_StoneExchangeRequiredCount[Count])
+	if (lpObj->UserData->ArcherCoinCount[Type] < this->m_StoneExchangeRequiredCount[Count])
 	{
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(28, lpObj->Lang), this->m_StoneExchangeRequiredCount[Count]);
 
@@ -409,9 +409,9 @@ void CGoldenArcher::GoldenArcherExchangeStoneVIP(int aIndex, int Type, int Count
 		return;
 	}
 
-	lpObj->ArcherCoinCount[Type] -= this->m_StoneExchangeRequiredCount[Count];
+	lpObj->UserData->ArcherCoinCount[Type] -= this->m_StoneExchangeRequiredCount[Count];
 
-	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->ArcherCoinCount[Type]);
+	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->UserData->ArcherCoinCount[Type]);
 
 	GJAccountLevelSaveSend(lpObj->Index, (Count + 1), this->m_StoneExchangeVipDuration[Count] * 3600);
 
@@ -426,7 +426,7 @@ void CGoldenArcher::GoldenArcherExchangeStoneLuckyNumber(int aIndex, int Type, i
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
-	if (lpObj->ArcherLuckyNumber[0] != '\0')
+	if (lpObj->UserData->ArcherLuckyNumber[0] != '\0')
 	{
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(30, lpObj->Lang));
 
@@ -437,14 +437,14 @@ void CGoldenArcher::GoldenArcherExchangeStoneLuckyNumber(int aIndex, int Type, i
 
 	for (int i = 0; i < 12; ++i)
 	{
-		lpObj->ArcherLuckyNumber[i] = Randomize[GetLargeRand() % (sizeof(Randomize) - 1)];
+		lpObj->UserData->ArcherLuckyNumber[i] = Randomize[GetLargeRand() % (sizeof(Randomize) - 1)];
 	}
 
-	lpObj->ArcherLuckyNumber[12] = '\0';
+	lpObj->UserData->ArcherLuckyNumber[12] = '\0';
 
-	lpObj->ArcherCoinCount[Type] -= this->m_StoneExchangeRequiredCount[Count];
+	lpObj->UserData->ArcherCoinCount[Type] -= this->m_StoneExchangeRequiredCount[Count];
 
-	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->ArcherCoinCount[Type]);
+	this->GCGoldenArcherRegisterSend(lpObj->Index, lpObj->UserData->ArcherCoinCount[Type]);
 
 	this->GDGoldenArcherSaveCoinSend(lpObj->Index);
 
@@ -461,7 +461,7 @@ void CGoldenArcher::GCGoldenArcherLuckyNumberSend(int aIndex)
 
 	pMsg.header.set(0x96, sizeof(pMsg));
 
-	memcpy(pMsg.LuckyNumber, gObj[aIndex].ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
+	memcpy(pMsg.LuckyNumber, gObj[aIndex].UserData->ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
 
 	DataSend(aIndex, (BYTE*)&pMsg, pMsg.header.size);
 }
@@ -476,7 +476,7 @@ void CGoldenArcher::GDGoldenArcherSaveLuckyNumberSend(int aIndex)
 
 	memcpy(pMsg.account, gObj[aIndex].Account, sizeof(pMsg.account));
 
-	memcpy(pMsg.LuckyNumber, gObj[aIndex].ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
+	memcpy(pMsg.LuckyNumber, gObj[aIndex].UserData->ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
 
 	gDataServerConnection.DataSend((BYTE*)&pMsg, sizeof(pMsg));
 }
@@ -501,14 +501,14 @@ void CGoldenArcher::CGGoldenArcherRegisterLuckyRecv(PMSG_GOLDEN_ARCHER_REGISTER_
 		return;
 	}
 
-	if (lpObj->ArcherLuckyNumber[0] == '\0')
+	if (lpObj->UserData->ArcherLuckyNumber[0] == '\0')
 	{
 		this->GCGoldenArcherRegisterLuckySend(aIndex, 2);
 
 		return;
 	}
 
-	if (strcmp(lpMsg->LuckyNumber, lpObj->ArcherLuckyNumber) != 0)
+	if (strcmp(lpMsg->LuckyNumber, lpObj->UserData->ArcherLuckyNumber) != 0)
 	{
 		this->GCGoldenArcherRegisterLuckySend(aIndex, 3);
 
@@ -528,7 +528,7 @@ void CGoldenArcher::GDGoldenArcherRegisterLuckyNumberSend(int aIndex)
 
 	memcpy(pMsg.account, gObj[aIndex].Account, sizeof(pMsg.account));
 
-	memcpy(pMsg.LuckyNumber, gObj[aIndex].ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
+	memcpy(pMsg.LuckyNumber, gObj[aIndex].UserData->ArcherLuckyNumber, sizeof(pMsg.LuckyNumber));
 
 	gDataServerConnection.DataSend((BYTE*)&pMsg, sizeof(pMsg));
 }
@@ -549,9 +549,9 @@ void CGoldenArcher::DGGoldenArcherRegisterLuckyRecv(SDHP_GOLDEN_ARCHER_SAVE_LUCK
 
 	if (lpMsg->Result == 0)
 	{
-		lpObj->RegisteredLuckyNumbers.push_back(lpObj->ArcherLuckyNumber);
+		lpObj->UserData->RegisteredLuckyNumbers.push_back(lpObj->UserData->ArcherLuckyNumber);
 
-		memset(lpObj->ArcherLuckyNumber, 0, sizeof(lpObj->ArcherLuckyNumber));
+		memset(lpObj->UserData->ArcherLuckyNumber, 0, sizeof(lpObj->UserData->ArcherLuckyNumber));
 
 		this->GCGoldenArcherLuckyNumberSend(lpObj->Index);
 
@@ -598,14 +598,14 @@ void CGoldenArcher::CGGoldenArcherExchangeLuckyRecv(PMSG_GOLDEN_ARCHER_EXCHANGE_
 		return;
 	}
 
-	if (lpObj->RegisteredLuckyNumbers.size() == 0)
+	if (lpObj->UserData->RegisteredLuckyNumbers.size() == 0)
 	{
 		this->GCGoldenArcherExchangeLuckySend(aIndex, 2);
 
 		return;
 	}
 
-	if (std::find(lpObj->RegisteredLuckyNumbers.begin(), lpObj->RegisteredLuckyNumbers.end(), lpMsg->LuckyNumber) == lpObj->RegisteredLuckyNumbers.end())
+	if (std::find(lpObj->UserData->RegisteredLuckyNumbers.begin(), lpObj->UserData->RegisteredLuckyNumbers.end(), lpMsg->LuckyNumber) == lpObj->UserData->RegisteredLuckyNumbers.end())
 	{
 		this->GCGoldenArcherExchangeLuckySend(aIndex, 3);
 
@@ -660,6 +660,6 @@ void CGoldenArcher::ClearRegisteredLuckyNumbers()
 			continue;
 		}
 
-		gObj[n].RegisteredLuckyNumbers.clear();
+		gObj[n].UserData->RegisteredLuckyNumbers.clear();
 	}
 }
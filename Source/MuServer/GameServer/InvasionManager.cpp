@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "InvasionManager.h"
 #include "FlyingDragons.h"
+#include "Map.h"
 #include "ReadScript.h"
 #include "Monster.h"
 #include "MonsterSetBase.h"
@@ -368,6 +369,8 @@ void CInvasionManager::SetState(INVASION_INFO* lpInfo, int state)
 			break;
 		}
 	}
+
+	this->SetEventMap();
 }
 
 void CInvasionManager::SetState_BLANK(INVASION_INFO* lpInfo)
@@ -445,6 +448,40 @@ int CInvasionManager::GetState(int index)
 	return this->m_InvasionInfo[index].State;
 }
 
+bool CInvasionManager::CheckInvasionMap(int map)
+{
+	for (int n = 0; n < MAX_INVASION; n++)
+	{
+		INVASION_INFO* lpInfo = &this->m_InvasionInfo[n];
+
+		if (lpInfo->State != INVASION_STATE_START)
+		{
+			continue;
+		}
+
+		for (int i = 0; i < MAX_INVASION_RESPAWN_GROUP; i++)
+		{
+			for (std::vector<INVASION_RESPWAN_INFO>::iterator it = lpInfo->RespawnInfo[i].begin(); it != lpInfo->RespawnInfo[i].end(); it++)
+			{
+				if (it->Map == map)
+				{
+					return 1;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+void CInvasionManager::SetEventMap()
+{
+	for (int n = 0; n < MAX_MAP; n++)
+	{
+		gMap[n].m_EventMap = (BC_MAP_RANGE(n) != 0 || DS_MAP_RANGE(n) != 0 || this->CheckInvasionMap(n) != 0);
+	}
+}
+
 char* CInvasionManager::GetInvasionName(int index)
 {
 	if (index < 0 || index >= MAX_INVASION)
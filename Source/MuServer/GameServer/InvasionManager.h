@@ -94,6 +94,10 @@ public:
 
 	int GetState(int index);
 
+	bool CheckInvasionMap(int map);
+
+	void SetEventMap();
+
 	char* GetInvasionName(int index);
 
 	int GetCurrentRemainTime(int index);
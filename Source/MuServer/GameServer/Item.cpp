@@ -105,14 +105,14 @@ bool CItem::IsClass(int Class, int ChangeUp)
 		return 0;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(this->m_Index);
 
-	if (gItemManager.GetInfo(this->m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0;
 	}
 
-	if (ItemInfo.RequireClass[Class] <= 0 || (ChangeUp + 1) < ItemInfo.RequireClass[Class])
+	if (lpItemInfo->RequireClass[Class] <= 0 || (ChangeUp + 1) < lpItemInfo->RequireClass[Class])
 	{
 		return 0;
 	}
@@ -124,9 +124,9 @@ bool CItem::IsClass(int Class, int ChangeUp)
 
 void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption, BYTE ExceOption)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(index);
 
-	if (gItemManager.GetInfo(index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
@@ -135,7 +135,7 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 
 	this->m_Level &= 15;
 
-	this->m_Slot = ItemInfo.Slot;
+	this->m_Slot = lpItemInfo->Slot;
 
 	this->m_SkillOption = SkillOption;
 
@@ -178,25 +178,25 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 		this->m_BaseDurability = (float)gItemManager.GetItemDurability(this->m_Index, this->m_Level, ExceOption);
 	}
 
-	this->m_Value = ItemInfo.Value;
+	this->m_Value = lpItemInfo->Value;
 
-	this->m_AttackSpeed = ItemInfo.AttackSpeed;
+	this->m_AttackSpeed = lpItemInfo->AttackSpeed;
 
-	this->m_TwoHand = ItemInfo.TwoHand;
+	this->m_TwoHand = lpItemInfo->TwoHand;
 
-	this->m_DamageMin = ItemInfo.DamageMin;
+	this->m_DamageMin = lpItemInfo->DamageMin;
 
-	this->m_DamageMax = ItemInfo.DamageMax;
+	this->m_DamageMax = lpItemInfo->DamageMax;
 
-	this->m_DefenseSuccessRate = ItemInfo.DefenseSuccessRate;
+	this->m_DefenseSuccessRate = lpItemInfo->DefenseSuccessRate;
 
-	this->m_Defense = ItemInfo.Defense;
+	this->m_Defense = lpItemInfo->Defense;
 
-	this->m_MagicDefense = ItemInfo.MagicDefense;
+	this->m_MagicDefense = lpItemInfo->MagicDefense;
 
-	this->m_WalkSpeed = ItemInfo.WalkSpeed;
+	this->m_WalkSpeed = lpItemInfo->WalkSpeed;
 
-	this->m_MagicDamageRate = ItemInfo.MagicDamageRate;
+	this->m_MagicDamageRate = lpItemInfo->MagicDamageRate;
 
 	this->m_DurabilityState[0] = this->m_BaseDurability * 0.5f;
 
@@ -231,10 +231,10 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 
 	for (int n = 0; n < MAX_RESISTANCE_TYPE; n++)
 	{
-		this->m_Resistance[n] = (((ItemInfo.Resistance[n] * this->m_Level) > 255) ? 255 : (ItemInfo.Resistance[n] * this->m_Level));
+		this->m_Resistance[n] = (((lpItemInfo->Resistance[n] * this->m_Level) > 255) ? 255 : (lpItemInfo->Resistance[n] * this->m_Level));
 	}
 
-	int ItemLevel = ItemInfo.Level;
+	int ItemLevel = lpItemInfo->Level;
 
 	if (ExceOption != 0)
 	{
@@ -251,54 +251,54 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 
 	this->m_RequireVitality = 0;
 
-	if (ItemInfo.RequireStrength != 0)
+	if (lpItemInfo->RequireStrength != 0)
 	{
-		this->m_RequireStrength = (((ItemInfo.RequireStrength * ((this->m_Level * 3) + ItemLevel)) * 3) / 100) + 20;
+		this->m_RequireStrength = (((lpItemInfo->RequireStrength * ((this->m_Level * 3) + ItemLevel)) * 3) / 100) + 20;
 	}
 
-	if (ItemInfo.RequireDexterity != 0)
+	if (lpItemInfo->RequireDexterity != 0)
 	{
-		this->m_RequireDexterity = (((ItemInfo.RequireDexterity * ((this->m_Level * 3) + ItemLevel)) * 3) / 100) + 20;
+		this->m_RequireDexterity = (((lpItemInfo->RequireDexterity * ((this->m_Level * 3) + ItemLevel)) * 3) / 100) + 20;
 	}
 
-	if (ItemInfo.RequireVitality != 0)
+	if (lpItemInfo->RequireVitality != 0)
 	{
-		this->m_RequireVitality = (((ItemInfo.RequireVitality * ((this->m_Level * 3) + ItemLevel)) * 3) / 100) + 20;
+		this->m_RequireVitality = (((lpItemInfo->RequireVitality * ((this->m_Level * 3) + ItemLevel)) * 3) / 100) + 20;
 	}
 
-	if ((this->m_Index / MAX_ITEM_TYPE) == 5 && ItemInfo.Slot == 1)
+	if ((this->m_Index / MAX_ITEM_TYPE) == 5 && lpItemInfo->Slot == 1)
 	{
-		if (ItemInfo.RequireEnergy != 0)
+		if (lpItemInfo->RequireEnergy != 0)
 		{
-			this->m_RequireEnergy = (((ItemInfo.RequireEnergy * (this->m_Level + ItemLevel)) * 3) / 100) + 20;
+			this->m_RequireEnergy = (((lpItemInfo->RequireEnergy * (this->m_Level + ItemLevel)) * 3) / 100) + 20;
 		}
 	}
 	else
 	{
-		if (ItemInfo.RequireEnergy != 0)
+		if (lpItemInfo->RequireEnergy != 0)
 		{
-			this->m_RequireEnergy = (((ItemInfo.RequireEnergy * ((this->m_Level * 3) + ItemLevel)) * 4) / 100) + 20;
+			this->m_RequireEnergy = (((lpItemInfo->RequireEnergy * ((this->m_Level * 3) + ItemLevel)) * 4) / 100) + 20;
 		}
 	}
 
-	if (ItemInfo.RequireLevel != 0)
+	if (lpItemInfo->RequireLevel != 0)
 	{
 		if (this->m_Index >= GET_ITEM(0, 0) && this->m_Index < GET_ITEM(12, 0))
 		{
-			this->m_RequireLevel = ItemInfo.RequireLevel;
+			this->m_RequireLevel = lpItemInfo->RequireLevel;
 		}
 		else if ((this->m_Index >= GET_ITEM(12, 3) && this->m_Index <= GET_ITEM(12, 6)) // Wings
 			|| gCustomWing.CheckCustomWingByItem(this->m_Index)) // Custom Wings
 		{
-			this->m_RequireLevel = ItemInfo.RequireLevel + (this->m_Level * 5);
+			this->m_RequireLevel = lpItemInfo->RequireLevel + (this->m_Level * 5);
 		}
 		else if ((this->m_Index >= GET_ITEM(12, 7) && this->m_Index <= GET_ITEM(12, 19) && this->m_Index != GET_ITEM(12, 15))) // Orbs,Scrolls
 		{
-			this->m_RequireLevel = ItemInfo.RequireLevel;
+			this->m_RequireLevel = lpItemInfo->RequireLevel;
 		}
 		else
 		{
-			this->m_RequireLevel = ItemInfo.RequireLevel + (this->m_Level * 4);
+			this->m_RequireLevel = lpItemInfo->RequireLevel + (this->m_Level * 4);
 		}
 	}
 
@@ -345,9 +345,9 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 			{
 				this->m_DamageMax += ChaosItem;
 			}
-			else if (ItemInfo.Level != 0)
+			else if (lpItemInfo->Level != 0)
 			{
-				this->m_DamageMax += ((this->m_DamageMin * 25) / ItemInfo.Level) + 5;
+				this->m_DamageMax += ((this->m_DamageMin * 25) / lpItemInfo->Level) + 5;
 			}
 		}
 
@@ -367,9 +367,9 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 			{
 				this->m_DamageMin += ChaosItem;
 			}
-			else if (ItemInfo.Level != 0)
+			else if (lpItemInfo->Level != 0)
 			{
-				this->m_DamageMin += ((this->m_DamageMin * 25) / ItemInfo.Level) + 5;
+				this->m_DamageMin += ((this->m_DamageMin * 25) / lpItemInfo->Level) + 5;
 			}
 		}
 
@@ -389,9 +389,9 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 			{
 				this->m_MagicDamageRate += ChaosItem;
 			}
-			else if (ItemInfo.Level != 0)
+			else if (lpItemInfo->Level != 0)
 			{
-				this->m_MagicDamageRate += ((this->m_MagicDamageRate * 25) / ItemInfo.Level) + 5;
+				this->m_MagicDamageRate += ((this->m_MagicDamageRate * 25) / lpItemInfo->Level) + 5;
 			}
 		}
 
@@ -405,9 +405,9 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 
 	if (this->m_DefenseSuccessRate > 0)
 	{
-		if (ExceOption != 0 && ItemInfo.Level != 0)
+		if (ExceOption != 0 && lpItemInfo->Level != 0)
 		{
-			this->m_DefenseSuccessRate += ((this->m_DefenseSuccessRate * 25) / ItemInfo.Level) + 5;
+			this->m_DefenseSuccessRate += ((this->m_DefenseSuccessRate * 25) / lpItemInfo->Level) + 5;
 		}
 
 		this->m_DefenseSuccessRate += (this->m_Level * 3);
@@ -426,9 +426,9 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 		}
 		else
 		{
-			if (ExceOption != 0 && ItemInfo.Level != 0)
+			if (ExceOption != 0 && lpItemInfo->Level != 0)
 			{
-				this->m_Defense += (((this->m_Defense * 12) / ItemInfo.Level) + (ItemInfo.Level / 5)) + 4;
+				this->m_Defense += (((this->m_Defense * 12) / lpItemInfo->Level) + (lpItemInfo->Level / 5)) + 4;
 			}
 
 			if ((this->m_Index >= GET_ITEM(12, 3) && this->m_Index <= GET_ITEM(12, 6))) // 2sd Wings
@@ -584,7 +584,7 @@ void CItem::Convert(int index, BYTE SkillOption, BYTE LuckOption, BYTE AddOption
 
 	if (gItemOption.GetItemOption(SPECIAL_SKILL_OPTION, this->m_Index, this->m_SkillOption, this->m_LuckOption, this->m_AddOption, this->m_ExceOption, &pItemOption, &pItemValue))
 	{
-		if (pItemOption != SKILL_NONE || (pItemOption = ItemInfo.Skill) != SKILL_NONE)
+		if (pItemOption != SKILL_NONE || (pItemOption = lpItemInfo->Skill) != SKILL_NONE)
 		{
 			ToInsertOptions.insert(ToInsertOptions.begin(), { pItemOption, pItemValue });
 
@@ -634,22 +634,22 @@ void CItem::Value()
 		return;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(this->m_Index);
 
-	if (gItemManager.GetInfo(this->m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
 
-	if (ItemInfo.BuyMoney != 0)
+	if (lpItemInfo->BuyMoney != 0)
 	{
-		this->m_BuyMoney = ItemInfo.BuyMoney;
+		this->m_BuyMoney = lpItemInfo->BuyMoney;
 
 		this->m_BuyMoney = ((this->m_BuyMoney >= 100) ? ((this->m_BuyMoney / 10) * 10) : this->m_BuyMoney);
 
 		this->m_BuyMoney = ((this->m_BuyMoney >= 1000) ? ((this->m_BuyMoney / 100) * 100) : this->m_BuyMoney);
 
-		this->m_SellMoney = ItemInfo.BuyMoney / 3;
+		this->m_SellMoney = lpItemInfo->BuyMoney / 3;
 
 		this->m_SellMoney = ((this->m_SellMoney >= 100) ? ((this->m_SellMoney / 10) * 10) : this->m_SellMoney);
 
@@ -664,9 +664,9 @@ void CItem::Value()
 	{
 
 	}
-	else if (ItemInfo.Value > 0)
+	else if (lpItemInfo->Value > 0)
 	{
-		price = ((ItemInfo.Value * ItemInfo.Value) * 10) / 12;
+		price = ((lpItemInfo->Value * lpItemInfo->Value) * 10) / 12;
 
 		if (this->m_Index >= GET_ITEM(14, 0) && this->m_Index <= GET_ITEM(14, 8))
 		{
@@ -694,7 +694,7 @@ void CItem::Value()
 	}
 	else
 	{
-		int ItemLevel = ItemInfo.Level + (this->m_Level * 3);
+		int ItemLevel = lpItemInfo->Level + (this->m_Level * 3);
 
 		for (int n = 0; n < this->m_OptionsQuant; n++)
 		{
@@ -786,7 +786,7 @@ void CItem::Value()
 
 			if (this->m_Index >= GET_ITEM(0, 0) && this->m_Index < GET_ITEM(6, 0))
 			{
-				if (ItemInfo.TwoHand == 0)
+				if (lpItemInfo->TwoHand == 0)
 				{
 					price = (price * 80) / 100;
 				}
@@ -836,7 +836,7 @@ void CItem::Value()
 
 	this->m_SellMoney = (DWORD)price;
 
-	this->m_SellMoney = ((ItemInfo.Slot >= 0 && ItemInfo.Slot <= 11) ? (this->m_SellMoney - (DWORD)((this->m_SellMoney * 0.6) * (1 - (this->m_Durability / this->m_BaseDurability)))) : this->m_SellMoney);
+	this->m_SellMoney = ((lpItemInfo->Slot >= 0 && lpItemInfo->Slot <= 11) ? (this->m_SellMoney - (DWORD)((this->m_SellMoney * 0.6) * (1 - (this->m_Durability / this->m_BaseDurability)))) : this->m_SellMoney);
 
 	this->m_SellMoney = ((this->m_SellMoney >= 100) ? ((this->m_SellMoney / 10) * 10) : this->m_SellMoney);
 
@@ -883,9 +883,9 @@ int CItem::GetItemSkill()
 		return 0;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(this->m_Index);
 
-	if (gItemManager.GetInfo(this->m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0;
 	}
@@ -896,7 +896,7 @@ int CItem::GetItemSkill()
 
 	if (gItemOption.GetItemOption(SPECIAL_SKILL_OPTION, this->m_Index, this->m_SkillOption, this->m_LuckOption, this->m_AddOption, this->m_ExceOption, &pItemOption, &pItemValue))
 	{
-		if (pItemOption != SKILL_NONE || (pItemOption = ItemInfo.Skill) != SKILL_NONE)
+		if (pItemOption != SKILL_NONE || (pItemOption = lpItemInfo->Skill) != SKILL_NONE)
 		{
 			return pItemOption;
 		}
@@ -1048,9 +1048,9 @@ bool CItem::ArmorDurabilityDown(int aIndex, int damage)
 		return 0;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(this->m_Index);
 
-	if (gItemManager.GetInfo(this->m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0;
 	}
@@ -1065,25 +1065,25 @@ bool CItem::ArmorDurabilityDown(int aIndex, int damage)
 
 		defense += this->m_AddOption * 5;
 	}
-	else if (ItemInfo.RequireClass[CLASS_DW] != 0)
+	else if (lpItemInfo->RequireClass[CLASS_DW] != 0)
 	{
 		defense *= 3;
 
 		defense += this->m_AddOption * 4;
 	}
-	else if (ItemInfo.RequireClass[CLASS_DK] != 0)
+	else if (lpItemInfo->RequireClass[CLASS_DK] != 0)
 	{
 		defense *= 3;
 
 		defense += this->m_AddOption * 4;
 	}
-	else if (ItemInfo.RequireClass[CLASS_FE] != 0)
+	else if (lpItemInfo->RequireClass[CLASS_FE] != 0)
 	{
 		defense *= 2;
 
 		defense += this->m_AddOption * 4;
 	}
-	else if (ItemInfo.RequireClass[CLASS_MG] != 0)
+	else if (lpItemInfo->RequireClass[CLASS_MG] != 0)
 	{
 		defense *= 7;
 
@@ -207,7 +207,7 @@ bool::CItemBag::GetRandomItemDropLocation(int map, int* ox, int* oy, int tx, int
 
 		(*oy) = ((GetLargeRand() % (ty + 1)) * ((GetLargeRand() % 2 == 0) ? -1 : 1)) + y;
 
-		if (gMap[map].CheckAttr((*ox), (*oy), 4) == 0 && gMap[map].CheckAttr((*ox), (*oy), 8) == 0)
+		if (gMap[map].CheckWalkAttr((*ox), (*oy)) != 0)
 		{
 			return 1;
 		}
@@ -289,7 +289,7 @@ bool CItemBag::DropItem(LPOBJ lpObj, int map, int x, int y)
 
 		int py = y;
 
-		if (this->m_ItemDropCount > 1 || (gMap[map].CheckAttr(px, py, 4) != 0 || gMap[map].CheckAttr(px, py, 8) != 0))
+		if (this->m_ItemDropCount > 1 || (gMap[map].CheckWalkAttr(px, py) == 0))
 		{
 			if (this->GetRandomItemDropLocation(map, &px, &py, 2, 2, 10) == 0)
 			{
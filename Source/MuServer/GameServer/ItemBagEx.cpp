@@ -251,7 +251,7 @@ bool CItemBagEx::DropItem(LPOBJ lpObj, int map, int x, int y)
 
 			int py = y;
 
-			if (it != this->m_ItemBagInfo.begin() || (gMap[map].CheckAttr(px, py, 4) != 0 || gMap[map].CheckAttr(px, py, 8) != 0))
+			if (it != this->m_ItemBagInfo.begin() || (gMap[map].CheckWalkAttr(px, py) == 0))
 			{
 				if (this->GetRandomItemDropLocation(map, &px, &py, 2, 2, 10) == 0)
 				{
@@ -359,7 +359,7 @@ bool::CItemBagEx::GetRandomItemDropLocation(int map, int* ox, int* oy, int tx, i
 
 		(*oy) = ((GetLargeRand() % (ty + 1)) * ((GetLargeRand() % 2 == 0) ? -1 : 1)) + y;
 
-		if (gMap[map].CheckAttr((*ox), (*oy), 4) == 0 && gMap[map].CheckAttr((*ox), (*oy), 8) == 0)
+		if (gMap[map].CheckWalkAttr((*ox), (*oy)) != 0)
 		{
 			return 1;
 		}
@@ -14,6 +14,8 @@ CItemDrop gItemDrop;
 CItemDrop::CItemDrop()
 {
 	this->m_ItemDropInfo.clear();
+
+	this->MakeItemDropList();
 }
 
 CItemDrop::~CItemDrop()
@@ -94,49 +96,90 @@ void CItemDrop::Load(const char* path)
 		ErrorMessageBox(lpReadScript->GetError());
 	}
 
+	this->MakeItemDropList();
+
 	delete lpReadScript;
 }
 
 int CItemDrop::DropItem(LPOBJ lpObj, LPOBJ lpTarget)
 {
-	CRandomManager RandomManager;
+	ITEM_DROP_INFO* lpItemDropInfo = this->GetItemDropInfo(lpObj, lpTarget);
 
-	for (std::vector<ITEM_DROP_INFO>::iterator it = this->m_ItemDropInfo.begin(); it != this->m_ItemDropInfo.end(); it++)
+	if (lpItemDropInfo == 0)
 	{
-		int DropRate;
+		return 0;
+	}
+	else
+	{
+		WORD ItemIndex = lpItemDropInfo->Index;
 
-		ITEM_INFO ItemInfo;
+		BYTE ItemLevel = lpItemDropInfo->Level;
 
-		if (gItemManager.GetInfo(it->Index, &ItemInfo) == 0)
-		{
-			continue;
-		}
+		BYTE ItemSkillOption = 0;
 
-		if (it->MapNumber != -1 && it->MapNumber != lpObj->Map)
-		{
-			continue;
-		}
+		BYTE ItemLuckOption = 0;
 
-		if (it->MonsterClass != -1 && it->MonsterClass != lpObj->Class)
-		{
-			continue;
-		}
+		BYTE ItemAddOption = 0;
+
+		BYTE ItemExceOption = 0;
+
+		gItemOptionRate.GetItemLevelOption(lpItemDropInfo->LevelOptionRate, &ItemLevel);
+
+		gItemOptionRate.GetItemSkillOption(lpItemDropInfo->SkillOptionRate, &ItemSkillOption);
+
+		gItemOptionRate.GetItemLuckOption(lpItemDropInfo->LuckOptionRate, &ItemLuckOption);
+
+		gItemOptionRate.GetItemAddOption(lpItemDropInfo->AddOptionRate, &ItemAddOption);
+
+		gItemOptionRate.GetItemExceOption(lpItemDropInfo->ExceOptionRate, &ItemExceOption);
+
+		gItemOptionRate.MakeExceOption(ItemIndex, ItemExceOption, &ItemExceOption);
+
+		GDCreateItemSend(lpTarget->Index, lpObj->Map, (BYTE)lpObj->X, (BYTE)lpObj->Y, ItemIndex, ItemLevel, 0, ItemSkillOption, ItemLuckOption, ItemAddOption, lpTarget->Index, ((ItemExceOption == 0) ? lpItemDropInfo->Grade : ItemExceOption));
+
+		return 1;
+	}
+}
+
+int CItemDrop::GetItemDropRate(LPOBJ lpObj, LPOBJ lpTarget, int ItemIndex, int ItemLevel, int DropRate)
+{
+	return gBonusManager.GetBonusValue(lpTarget, BONUS_INDEX_CMN_ITEM_DROP_RATE, DropRate, ItemIndex, ItemLevel, lpObj->Class, lpObj->Level);
+}
+
+ITEM_DROP_INFO* CItemDrop::GetItemDropInfo(LPOBJ lpObj, LPOBJ lpTarget)
+{
+	if (CHECK_RANGE(lpObj->Map, MAX_MAP) == 0)
+	{
+		return 0;
+	}
+
+	CRandomManager RandomManager;
+
+	int level = (int)(std::upper_bound(this->m_ItemDropLevel.begin(), this->m_ItemDropLevel.end(), lpObj->Level) - this->m_ItemDropLevel.begin());
 
-		if (it->MonsterLevelMin != -1 && it->MonsterLevelMin > lpObj->Level)
+	std::vector<int>* lpItemDropList = &this->m_ItemDropList[lpObj->Map][level];
+
+	for (std::vector<int>::iterator it = lpItemDropList->begin(); it != lpItemDropList->end(); it++)
+	{
+		ITEM_DROP_INFO* lpInfo = &this->m_ItemDropInfo[(*it)];
+
+		if (gItemManager.GetInfo(lpInfo->Index) == 0)
 		{
 			continue;
 		}
 
-		if (it->MonsterLevelMax != -1 && it->MonsterLevelMax < lpObj->Level)
+		if (lpInfo->MonsterClass != -1 && lpInfo->MonsterClass != lpObj->Class)
 		{
 			continue;
 		}
 
-		if ((DropRate = it->DropRate) == -1 || (GetLargeRand() % 1000000) < (DropRate = this->GetItemDropRate(lpObj, lpTarget, it->Index, it->Level, it->DropRate)))
+		int DropRate;
+
+		if ((DropRate = lpInfo->DropRate) == -1 || (GetLargeRand() % 1000000) < (DropRate = this->GetItemDropRate(lpObj, lpTarget, lpInfo->Index, lpInfo->Level, lpInfo->DropRate)))
 		{
 			int rate = (1000000 / ((DropRate == -1) ? 1000000 : DropRate));
 
-			RandomManager.AddElement(reinterpret_cast<intptr_t>(&(*it)), rate);
+			RandomManager.AddElement(reinterpret_cast<intptr_t>(lpInfo), rate);
 		}
 	}
 
@@ -146,42 +189,66 @@ int CItemDrop::DropItem(LPOBJ lpObj, LPOBJ lpTarget)
 	{
 		return 0;
 	}
-	else
-	{
-		ITEM_DROP_INFO* lpItemDropInfo = reinterpret_cast<ITEM_DROP_INFO*>(dropPtr);
 
-		WORD ItemIndex = lpItemDropInfo->Index;
+	return reinterpret_cast<ITEM_DROP_INFO*>(dropPtr);
+}
 
-		BYTE ItemLevel = lpItemDropInfo->Level;
+void CItemDrop::MakeItemDropList()
+{
+	// The rule level bounds split the monster levels into ranges where
+	// every rule either matches the whole range or none of it, so the
+	// map and level filters are answered once here instead of per kill.
 
-		BYTE ItemSkillOption = 0;
+	this->m_ItemDropLevel.clear();
 
-		BYTE ItemLuckOption = 0;
+	for (std::vector<ITEM_DROP_INFO>::iterator it = this->m_ItemDropInfo.begin(); it != this->m_ItemDropInfo.end(); it++)
+	{
+		if (it->MonsterLevelMin != -1)
+		{
+			this->m_ItemDropLevel.push_back(it->MonsterLevelMin);
+		}
 
-		BYTE ItemAddOption = 0;
+		if (it->MonsterLevelMax != -1)
+		{
+			this->m_ItemDropLevel.push_back(it->MonsterLevelMax + 1);
+		}
+	}
 
-		BYTE ItemExceOption = 0;
+	std::sort(this->m_ItemDropLevel.begin(), this->m_ItemDropLevel.end());
 
-		gItemOptionRate.GetItemLevelOption(lpItemDropInfo->LevelOptionRate, &ItemLevel);
+	this->m_ItemDropLevel.erase(std::unique(this->m_ItemDropLevel.begin(), this->m_ItemDropLevel.end()), this->m_ItemDropLevel.end());
 
-		gItemOptionRate.GetItemSkillOption(lpItemDropInfo->SkillOptionRate, &ItemSkillOption);
+	int count = (int)this->m_ItemDropLevel.size();
 
-		gItemOptionRate.GetItemLuckOption(lpItemDropInfo->LuckOptionRate, &ItemLuckOption);
+	for (int n = 0; n < MAX_MAP; n++)
+	{
+		this->m_ItemDropList[n].clear();
 
-		gItemOptionRate.GetItemAddOption(lpItemDropInfo->AddOptionRate, &ItemAddOption);
+		this->m_ItemDropList[n].resize(count + 1);
 
-		gItemOptionRate.GetItemExceOption(lpItemDropInfo->ExceOptionRate, &ItemExceOption);
+		for (int i = 0; i <= count; i++)
+		{
+			for (int k = 0; k < (int)this->m_ItemDropInfo.size(); k++)
+			{
+				ITEM_DROP_INFO* lpInfo = &this->m_ItemDropInfo[k];
 
-		gItemOptionRate.MakeExceOption(ItemIndex, ItemExceOption, &ItemExceOption);
+				if (lpInfo->MapNumber != -1 && lpInfo->MapNumber != n)
+				{
+					continue;
+				}
 
-		GDCreateItemSend(lpTarget->Index, lpObj->Map, (BYTE)lpObj->X, (BYTE)lpObj->Y, ItemIndex, ItemLevel, 0, ItemSkillOption, ItemLuckOption, ItemAddOption, lpTarget->Index, ((ItemExceOption == 0) ? lpItemDropInfo->Grade : ItemExceOption));
+				if (lpInfo->MonsterLevelMin != -1 && (i == 0 || lpInfo->MonsterLevelMin > this->m_ItemDropLevel[i - 1]))
+				{
+					continue;
+				}
 
-		return 1;
-	}
-}
+				if (lpInfo->MonsterLevelMax != -1 && (i == count || lpInfo->MonsterLevelMax < (this->m_ItemDropLevel[i] - 1)))
+				{
+					continue;
+				}
 
-int CItemDrop::GetItemDropRate(LPOBJ lpObj, LPOBJ lpTarget, int ItemIndex, int ItemLevel, int DropRate)
-{
-	return gBonusManager.GetBonusValue(lpTarget, BONUS_INDEX_CMN_ITEM_DROP_RATE, DropRate, ItemIndex, ItemLevel, lpObj->Class, lpObj->Level);
+				this->m_ItemDropList[n][i].push_back(k);
+			}
+		}
+	}
 }
-
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Map.h"
 #include "User.h"
 
 struct ITEM_DROP_INFO
@@ -33,9 +34,19 @@ public:
 
 	int GetItemDropRate(LPOBJ lpObj, LPOBJ lpTarget, int ItemIndex, int ItemLevel, int DropRate);
 
+private:
+
+	ITEM_DROP_INFO* GetItemDropInfo(LPOBJ lpObj, LPOBJ lpTarget);
+
+	void MakeItemDropList();
+
 private:
 
 	std::vector<ITEM_DROP_INFO> m_ItemDropInfo;
+
+	std::vector<int> m_ItemDropLevel;
+
+	std::vector<std::vector<int>> m_ItemDropList[MAX_MAP];
 };
 
 extern CItemDrop gItemDrop;
@@ -28,7 +28,14 @@ CItemManager gItemManager;
 
 CItemManager::CItemManager()
 {
-	this->m_ItemInfo.clear();
+	for (int n = 0; n < MAX_ITEM; n++)
+	{
+		this->m_ItemInfoTable[0][n].Index = -1;
+
+		this->m_ItemInfoTable[1][n].Index = -1;
+	}
+
+	this->m_ItemInfo = this->m_ItemInfoTable[0];
 }
 
 CItemManager::~CItemManager()
@@ -56,7 +63,12 @@ void CItemManager::Load(const char* path)
 		return;
 	}
 
-	this->m_ItemInfo.clear();
+	ITEM_INFO* lpItemInfo = ((this->m_ItemInfo == this->m_ItemInfoTable[0]) ? this->m_ItemInfoTable[1] : this->m_ItemInfoTable[0]);
+
+	for (int n = 0; n < MAX_ITEM; n++)
+	{
+		lpItemInfo[n].Index = -1;
+	}
 
 	try
 	{
@@ -240,7 +252,10 @@ void CItemManager::Load(const char* path)
 					}
 				}
 
-				this->m_ItemInfo.insert(std::pair<int, ITEM_INFO>(info.Index, info));
+				if (CHECK_ITEM(info.Index) != -1 && lpItemInfo[info.Index].Index == -1)
+				{
+					lpItemInfo[info.Index] = info;
+				}
 			}
 		}
 	}
@@ -249,58 +264,59 @@ void CItemManager::Load(const char* path)
 		ErrorMessageBox(lpReadScript->GetError());
 	}
 
+	this->m_ItemInfo = lpItemInfo;
+
 	delete lpReadScript;
 }
 
-bool CItemManager::GetInfo(int index, ITEM_INFO* lpInfo)
+ITEM_INFO* CItemManager::GetInfo(int index)
 {
-	std::map<int, ITEM_INFO>::iterator it = this->m_ItemInfo.find(index);
-
-	if (it == this->m_ItemInfo.end())
+	if (CHECK_ITEM(index) == -1)
 	{
 		return 0;
 	}
-	else
-	{
-		(*lpInfo) = it->second;
 
-		return 1;
+	if (this->m_ItemInfo[index].Index != index)
+	{
+		return 0;
 	}
+
+	return &this->m_ItemInfo[index];
 }
 
 int CItemManager::GetItemSkill(int index)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return -1;
 	}
 	else
 	{
-		return ItemInfo.Skill;
+		return lpItemInfo->Skill;
 	}
 }
 
 int CItemManager::GetItemTwoHand(int index)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return -1;
 	}
 	else
 	{
-		return ItemInfo.TwoHand;
+		return lpItemInfo->TwoHand;
 	}
 }
 
 int CItemManager::GetItemDurability(int index, int level, int ExceOption)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0;
 	}
@@ -315,11 +331,11 @@ int CItemManager::GetItemDurability(int index, int level, int ExceOption)
 		return 1;
 	}
 
-	int ItemDurability = ItemInfo.Durability;
+	int ItemDurability = lpItemInfo->Durability;
 
 	if (index >= GET_ITEM(5, 0) && index < GET_ITEM(6, 0)) // Staffs
 	{
-		ItemDurability = ItemInfo.MagicDurability;
+		ItemDurability = lpItemInfo->MagicDurability;
 	}
 
 	int dur = 0;
@@ -344,7 +360,7 @@ int CItemManager::GetItemDurability(int index, int level, int ExceOption)
 		dur = ItemDurability + level;
 	}
 
-	if (index != GET_ITEM(0, 19) && index != GET_ITEM(2, 13) && index != GET_ITEM(4, 18) && index != GET_ITEM(5, 10) && ItemInfo.Slot != 7) // Sword of Archangel,Scepter of Archangel,Crossbow of Archangel,Staff of Archangel
+	if (index != GET_ITEM(0, 19) && index != GET_ITEM(2, 13) && index != GET_ITEM(4, 18) && index != GET_ITEM(5, 10) && lpItemInfo->Slot != 7) // Sword of Archangel,Scepter of Archangel,Crossbow of Archangel,Staff of Archangel
 	{
 		if (ExceOption != 0)
 		{
@@ -367,14 +383,14 @@ int CItemManager::GetItemRepairMoney(CItem* lpItem, int type)
 		return 0;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(lpItem->m_Index);
 
-	if (this->GetInfo(lpItem->m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0;
 	}
 
-	if (((lpItem->m_Index >= GET_ITEM(5, 0) && lpItem->m_Index < GET_ITEM(6, 0)) ? ItemInfo.MagicDurability : ItemInfo.Durability) == 0)
+	if (((lpItem->m_Index >= GET_ITEM(5, 0) && lpItem->m_Index < GET_ITEM(6, 0)) ? lpItemInfo->MagicDurability : lpItemInfo->Durability) == 0)
 	{
 		return 0;
 	}
@@ -538,9 +554,9 @@ bool CItemManager::CheckItemRequireEnergy(LPOBJ lpObj, CItem* lpItem)
 
 bool CItemManager::CheckItemRequireClass(LPOBJ lpObj, int index)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0;
 	}
@@ -550,12 +566,12 @@ bool CItemManager::CheckItemRequireClass(LPOBJ lpObj, int index)
 		return 0;
 	}
 
-	if (ItemInfo.RequireClass[lpObj->Class] == 0)
+	if (lpItemInfo->RequireClass[lpObj->Class] == 0)
 	{
 		return 0;
 	}
 
-	if ((lpObj->ChangeUp + 1) >= ItemInfo.RequireClass[lpObj->Class])
+	if ((lpObj->ChangeUp + 1) >= lpItemInfo->RequireClass[lpObj->Class])
 	{
 		return 1;
 	}
@@ -762,9 +778,9 @@ bool CItemManager::CheckItemMoveToChaos(LPOBJ lpObj, CItem* lpItem, BYTE TargetF
 
 bool CItemManager::CheckItemInventorySpace(LPOBJ lpObj, int index)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0;
 	}
@@ -777,7 +793,7 @@ bool CItemManager::CheckItemInventorySpace(LPOBJ lpObj, int index)
 		{
 			if (lpObj->InventoryMap[((y * 8) + x)] == 0xFF)
 			{
-				if (this->InventoryRectCheck(lpObj->Index, x, y, ItemInfo.Width, ItemInfo.Height) != 0xFF)
+				if (this->InventoryRectCheck(lpObj->Index, x, y, lpItemInfo->Width, lpItemInfo->Height) != 0xFF)
 				{
 					return 1;
 				}
@@ -816,9 +832,9 @@ void CItemManager::InventoryItemSet(int aIndex, int slot, BYTE type)
 		return;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(gObj[aIndex].Inventory[slot].m_Index);
 
-	if (this->GetInfo(gObj[aIndex].Inventory[slot].m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
@@ -827,14 +843,14 @@ void CItemManager::InventoryItemSet(int aIndex, int slot, BYTE type)
 
 	int y = (slot - INVENTORY_WEAR_SIZE) / 8;
 
-	if (INVENTORY_MAIN_RANGE(slot) != false && ((x + ItemInfo.Width) > 8 || (y + ItemInfo.Height) > 8))
+	if (INVENTORY_MAIN_RANGE(slot) != false && ((x + lpItemInfo->Width) > 8 || (y + lpItemInfo->Height) > 8))
 	{
 		return;
 	}
 
-	for (int sy = 0; sy < ItemInfo.Height; sy++)
+	for (int sy = 0; sy < lpItemInfo->Height; sy++)
 	{
-		for (int sx = 0; sx < ItemInfo.Width; sx++)
+		for (int sx = 0; sx < lpItemInfo->Width; sx++)
 		{
 			gObj[aIndex].InventoryMap[(((sy + y) * 8) + (sx + x))] = type;
 		}
@@ -866,9 +882,9 @@ BYTE CItemManager::InventoryRectCheck(int aIndex, int x, int y, int width, int h
 
 BYTE CItemManager::InventoryInsertItem(int aIndex, CItem item)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-	if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0xFF;
 	}
@@ -881,7 +897,7 @@ BYTE CItemManager::InventoryInsertItem(int aIndex, CItem item)
 		{
 			if (gObj[aIndex].InventoryMap[((y * 8) + x)] == 0xFF)
 			{
-				BYTE slot = this->InventoryRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height);
+				BYTE slot = this->InventoryRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height);
 
 				if (slot != 0xFF)
 				{
@@ -914,9 +930,9 @@ BYTE CItemManager::InventoryAddItem(int aIndex, CItem item, int slot)
 
 	if (INVENTORY_WEAR_RANGE(slot) == 0)
 	{
-		ITEM_INFO ItemInfo;
+		ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-		if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+		if (lpItemInfo == 0)
 		{
 			return 0xFF;
 		}
@@ -925,7 +941,7 @@ BYTE CItemManager::InventoryAddItem(int aIndex, CItem item, int slot)
 
 		int y = (slot - INVENTORY_WEAR_SIZE) / 8;
 
-		if (this->InventoryRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height) == 0xFF)
+		if (this->InventoryRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height) == 0xFF)
 		{
 			return 0xFF;
 		}
@@ -1101,9 +1117,9 @@ void CItemManager::TradeItemSet(int aIndex, int slot, BYTE type)
 		return;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(gObj[aIndex].Trade[slot].m_Index);
 
-	if (this->GetInfo(gObj[aIndex].Trade[slot].m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
@@ -1112,14 +1128,14 @@ void CItemManager::TradeItemSet(int aIndex, int slot, BYTE type)
 
 	int y = slot / 8;
 
-	if ((x + ItemInfo.Width) > 8 || (y + ItemInfo.Height) > 4)
+	if ((x + lpItemInfo->Width) > 8 || (y + lpItemInfo->Height) > 4)
 	{
 		return;
 	}
 
-	for (int sy = 0; sy < ItemInfo.Height; sy++)
+	for (int sy = 0; sy < lpItemInfo->Height; sy++)
 	{
-		for (int sx = 0; sx < ItemInfo.Width; sx++)
+		for (int sx = 0; sx < lpItemInfo->Width; sx++)
 		{
 			gObj[aIndex].TradeMap[(((sy + y) * 8) + (sx + x))] = type;
 		}
@@ -1149,9 +1165,9 @@ BYTE CItemManager::TradeRectCheck(int aIndex, int x, int y, int width, int heigh
 
 BYTE CItemManager::TradeInsertItem(int aIndex, CItem item)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-	if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0xFF;
 	}
@@ -1162,7 +1178,7 @@ BYTE CItemManager::TradeInsertItem(int aIndex, CItem item)
 		{
 			if (gObj[aIndex].TradeMap[((y * 8) + x)] == 0xFF)
 			{
-				BYTE slot = this->TradeRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height);
+				BYTE slot = this->TradeRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height);
 
 				if (slot != 0xFF)
 				{
@@ -1193,9 +1209,9 @@ BYTE CItemManager::TradeAddItem(int aIndex, CItem item, int slot)
 		return 0xFF;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-	if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0xFF;
 	}
@@ -1204,7 +1220,7 @@ BYTE CItemManager::TradeAddItem(int aIndex, CItem item, int slot)
 
 	int y = slot / 8;
 
-	if (this->TradeRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height) == 0xFF)
+	if (this->TradeRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height) == 0xFF)
 	{
 		return 0xFF;
 	}
@@ -1230,9 +1246,9 @@ void CItemManager::WarehouseItemSet(int aIndex, int slot, BYTE type)
 		return;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(gObj[aIndex].Warehouse[slot].m_Index);
 
-	if (this->GetInfo(gObj[aIndex].Warehouse[slot].m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
@@ -1241,19 +1257,19 @@ void CItemManager::WarehouseItemSet(int aIndex, int slot, BYTE type)
 
 	int y = slot / 8;
 
-	if (WAREHOUSE_RANGE(slot) != false && ((x + ItemInfo.Width) > 8 || (y + ItemInfo.Height) > 15))
+	if (WAREHOUSE_RANGE(slot) != false && ((x + lpItemInfo->Width) > 8 || (y + lpItemInfo->Height) > 15))
 	{
 		return;
 	}
 
-	if (WAREHOUSE_RANGE(slot) != false && ((x + ItemInfo.Width) > 8 || (y + ItemInfo.Height) > 30))
+	if (WAREHOUSE_RANGE(slot) != false && ((x + lpItemInfo->Width) > 8 || (y + lpItemInfo->Height) > 30))
 	{
 		return;
 	}
 
-	for (int sy = 0; sy < ItemInfo.Height; sy++)
+	for (int sy = 0; sy < lpItemInfo->Height; sy++)
 	{
-		for (int sx = 0; sx < ItemInfo.Width; sx++)
+		for (int sx = 0; sx < lpItemInfo->Width; sx++)
 		{
 			gObj[aIndex].WarehouseMap[(((sy + y) * 8) + (sx + x))] = type;
 		}
@@ -1290,9 +1306,9 @@ BYTE CItemManager::WarehouseRectCheck(int aIndex, int x, int y, int width, int h
 
 BYTE CItemManager::WarehouseInsertItem(int aIndex, CItem item)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-	if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0xFF;
 	}
@@ -1305,7 +1321,7 @@ BYTE CItemManager::WarehouseInsertItem(int aIndex, CItem item)
 		{
 			if (gObj[aIndex].WarehouseMap[((y * 8) + x)] == 0xFF)
 			{
-				BYTE slot = this->WarehouseRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height);
+				BYTE slot = this->WarehouseRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height);
 
 				if (slot != 0xFF)
 				{
@@ -1336,9 +1352,9 @@ BYTE CItemManager::WarehouseAddItem(int aIndex, CItem item, int slot)
 		return 0xFF;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-	if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0xFF;
 	}
@@ -1347,7 +1363,7 @@ BYTE CItemManager::WarehouseAddItem(int aIndex, CItem item, int slot)
 
 	int y = slot / 8;
 
-	if (this->WarehouseRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height) == 0xFF)
+	if (this->WarehouseRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height) == 0xFF)
 	{
 		return 0xFF;
 	}
@@ -1373,9 +1389,9 @@ void CItemManager::ChaosBoxItemSet(int aIndex, int slot, BYTE type)
 		return;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(gObj[aIndex].ChaosBox[slot].m_Index);
 
-	if (this->GetInfo(gObj[aIndex].ChaosBox[slot].m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
@@ -1384,14 +1400,14 @@ void CItemManager::ChaosBoxItemSet(int aIndex, int slot, BYTE type)
 
 	int y = slot / 8;
 
-	if ((x + ItemInfo.Width) > 8 || (y + ItemInfo.Height) > 4)
+	if ((x + lpItemInfo->Width) > 8 || (y + lpItemInfo->Height) > 4)
 	{
 		return;
 	}
 
-	for (int sy = 0; sy < ItemInfo.Height; sy++)
+	for (int sy = 0; sy < lpItemInfo->Height; sy++)
 	{
-		for (int sx = 0; sx < ItemInfo.Width; sx++)
+		for (int sx = 0; sx < lpItemInfo->Width; sx++)
 		{
 			gObj[aIndex].ChaosBoxMap[(((sy + y) * 8) + (sx + x))] = type;
 		}
@@ -1421,9 +1437,9 @@ BYTE CItemManager::ChaosBoxRectCheck(int aIndex, int x, int y, int width, int he
 
 BYTE CItemManager::ChaosBoxInsertItem(int aIndex, CItem item)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-	if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0xFF;
 	}
@@ -1434,7 +1450,7 @@ BYTE CItemManager::ChaosBoxInsertItem(int aIndex, CItem item)
 		{
 			if (gObj[aIndex].ChaosBoxMap[((y * 8) + x)] == 0xFF)
 			{
-				BYTE slot = this->ChaosBoxRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height);
+				BYTE slot = this->ChaosBoxRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height);
 
 				if (slot != 0xFF)
 				{
@@ -1465,9 +1481,9 @@ BYTE CItemManager::ChaosBoxAddItem(int aIndex, CItem item, int slot)
 		return 0xFF;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = this->GetInfo(item.m_Index);
 
-	if (this->GetInfo(item.m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return 0xFF;
 	}
@@ -1476,7 +1492,7 @@ BYTE CItemManager::ChaosBoxAddItem(int aIndex, CItem item, int slot)
 
 	int y = slot / 8;
 
-	if (this->ChaosBoxRectCheck(aIndex, x, y, ItemInfo.Width, ItemInfo.Height) == 0xFF)
+	if (this->ChaosBoxRectCheck(aIndex, x, y, lpItemInfo->Width, lpItemInfo->Height) == 0xFF)
 	{
 		return 0xFF;
 	}
@@ -1495,22 +1511,22 @@ void CItemManager::ChaosBoxDelItem(int aIndex, int slot)
 	gObj[aIndex].ChaosBox[slot].Clear();
 }
 
-void CItemManager::ItemByteConvert(BYTE* lpMsg, CItem item)
+void CItemManager::ItemByteConvert(BYTE* lpMsg, CItem* lpItem)
 {
-	lpMsg[0] = item.m_Index & 0xFF;
+	lpMsg[0] = lpItem->m_Index & 0xFF;
 
 	lpMsg[1] = 0;
-	lpMsg[1] |= item.m_Level * 8;
-	lpMsg[1] |= item.m_SkillOption * 128;
-	lpMsg[1] |= item.m_LuckOption * 4;
-	lpMsg[1] |= item.m_AddOption & 3;
+	lpMsg[1] |= lpItem->m_Level * 8;
+	lpMsg[1] |= lpItem->m_SkillOption * 128;
+	lpMsg[1] |= lpItem->m_LuckOption * 4;
+	lpMsg[1] |= lpItem->m_AddOption & 3;
 
-	lpMsg[2] = (BYTE)item.m_Durability;
+	lpMsg[2] = (BYTE)lpItem->m_Durability;
 
 	lpMsg[3] = 0;
-	lpMsg[3] |= (item.m_Index & 256) >> 1;
-	lpMsg[3] |= ((item.m_AddOption > 3) ? 64 : 0);
-	lpMsg[3] |= item.m_ExceOption;
+	lpMsg[3] |= (lpItem->m_Index & 256) >> 1;
+	lpMsg[3] |= ((lpItem->m_AddOption > 3) ? 64 : 0);
+	lpMsg[3] |= lpItem->m_ExceOption;
 }
 
 void CItemManager::DBItemByteConvert(BYTE* lpMsg, CItem* lpItem)
@@ -2027,7 +2043,7 @@ BYTE CItemManager::MoveItemToTradeFromInventory(LPOBJ lpObj, BYTE SourceSlot, BY
 
 	BYTE ItemInfo[MAX_ITEM_INFO];
 
-	this->ItemByteConvert(ItemInfo, lpObj->Trade[TargetSlot]);
+	this->ItemByteConvert(ItemInfo, &lpObj->Trade[TargetSlot]);
 
 	gTrade.GCTradeItemAddSend(lpObj->TargetNumber, TargetSlot, ItemInfo);
 
@@ -2084,7 +2100,7 @@ BYTE CItemManager::MoveItemToTradeFromTrade(LPOBJ lpObj, BYTE SourceSlot, BYTE T
 
 	BYTE ItemInfo[MAX_ITEM_INFO];
 
-	this->ItemByteConvert(ItemInfo, lpObj->Trade[TargetSlot]);
+	this->ItemByteConvert(ItemInfo, &lpObj->Trade[TargetSlot]);
 
 	gTrade.GCTradeItemAddSend(lpObj->TargetNumber, TargetSlot, ItemInfo);
 
@@ -2384,7 +2400,7 @@ void CItemManager::CGItemGetRecv(PMSG_ITEM_GET_RECV* lpMsg, int aIndex)
 
 		pMsg.result = 0xFD;
 
-		this->ItemByteConvert(pMsg.ItemInfo, item);
+		this->ItemByteConvert(pMsg.ItemInfo, &item);
 
 		DataSend(aIndex, (BYTE*)&pMsg, pMsg.header.size);
 
@@ -2404,7 +2420,7 @@ void CItemManager::CGItemGetRecv(PMSG_ITEM_GET_RECV* lpMsg, int aIndex)
 
 	gMap[lpObj->Map].ItemGive(aIndex, index);
 
-	this->ItemByteConvert(pMsg.ItemInfo, item);
+	this->ItemByteConvert(pMsg.ItemInfo, &item);
 
 	DataSend(aIndex, (BYTE*)&pMsg, pMsg.header.size);
 
@@ -2577,70 +2593,70 @@ void CItemManager::CGItemMoveRecv(PMSG_ITEM_MOVE_RECV* lpMsg, int aIndex)
 	{
 		if ((pMsg.result = this->MoveItemToInventoryFromInventory(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Inventory[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Inventory[lpMsg->TargetSlot]);
 		}
 	}
 	else if (lpMsg->SourceFlag == 0 && lpMsg->TargetFlag == 1) // Inventory -> Trade
 	{
 		if ((pMsg.result = this->MoveItemToTradeFromInventory(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Trade[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Trade[lpMsg->TargetSlot]);
 		}
 	}
 	else if (lpMsg->SourceFlag == 0 && lpMsg->TargetFlag == 2) // Inventory -> Warehouse
 	{
 		if ((pMsg.result = this->MoveItemToWarehouseFromInventory(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Warehouse[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Warehouse[lpMsg->TargetSlot]);
 		}
 	}
 	else if (lpMsg->SourceFlag == 0 && (lpMsg->TargetFlag == 3 || (lpMsg->TargetFlag >= 5 && lpMsg->TargetFlag <= 20))) // Inventory -> Chaos Box
 	{
 		if ((pMsg.result = this->MoveItemToChaosBoxFromInventory(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->ChaosBox[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->ChaosBox[lpMsg->TargetSlot]);
 		}
 	}
 	else if (lpMsg->SourceFlag == 1 && lpMsg->TargetFlag == 0) // Trade -> Inventory
 	{
 		if ((pMsg.result = this->MoveItemToInventoryFromTrade(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Inventory[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Inventory[lpMsg->TargetSlot]);
 		}
 	}
 	else if (lpMsg->SourceFlag == 1 && lpMsg->TargetFlag == 1) // Trade -> Trade
 	{
 		if ((pMsg.result = this->MoveItemToTradeFromTrade(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Trade[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Trade[lpMsg->TargetSlot]);
 		}
 	}
 	else if (lpMsg->SourceFlag == 2 && lpMsg->TargetFlag == 0) // Warehouse -> Inventory
 	{
 		if ((pMsg.result = this->MoveItemToInventoryFromWarehouse(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Inventory[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Inventory[lpMsg->TargetSlot]);
 		}
 	}
 	else if (lpMsg->SourceFlag == 2 && lpMsg->TargetFlag == 2) // Warehouse -> Warehouse
 	{
 		if ((pMsg.result = this->MoveItemToWarehouseFromWarehouse(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Warehouse[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Warehouse[lpMsg->TargetSlot]);
 		}
 	}
 	else if ((lpMsg->SourceFlag == 3 || (lpMsg->SourceFlag >= 5 && lpMsg->SourceFlag <= 20)) && lpMsg->TargetFlag == 0) // Chaos Box -> Inventory
 	{
 		if ((pMsg.result = this->MoveItemToInventoryFromChaosBox(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->Inventory[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Inventory[lpMsg->TargetSlot]);
 		}
 	}
 	else if ((lpMsg->SourceFlag == 3 || (lpMsg->SourceFlag >= 5 && lpMsg->SourceFlag <= 20)) && (lpMsg->TargetFlag == 3 || (lpMsg->TargetFlag >= 5 && lpMsg->TargetFlag <= 20))) // Chaos Box -> Chaos Box
 	{
 		if ((pMsg.result = this->MoveItemToChaosBoxFromChaosBox(lpObj, lpMsg->SourceSlot, lpMsg->TargetSlot, lpMsg->TargetFlag)) != 0xFF)
 		{
-			this->ItemByteConvert(pMsg.ItemInfo, lpObj->ChaosBox[lpMsg->TargetSlot]);
+			this->ItemByteConvert(pMsg.ItemInfo, &lpObj->ChaosBox[lpMsg->TargetSlot]);
 		}
 	}
 
@@ -3047,7 +3063,7 @@ void CItemManager::CGItemBuyRecv(PMSG_ITEM_BUY_RECV* lpMsg, int aIndex)
 
 	GCMoneySend(aIndex, lpObj->Money);
 
-	this->ItemByteConvert(pMsg.ItemInfo, item);
+	this->ItemByteConvert(pMsg.ItemInfo, &item);
 
 	DataSend(aIndex, (BYTE*)&pMsg, pMsg.header.size);
 }
@@ -3244,7 +3260,7 @@ void CItemManager::GCItemChangeSend(int aIndex, BYTE slot)
 
 	pMsg.index[1] = SET_NUMBERLB(aIndex);
 
-	this->ItemByteConvert(pMsg.ItemInfo, lpObj->Inventory[slot]);
+	this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Inventory[slot]);
 
 	pMsg.ItemInfo[1] = slot * 16;
 
@@ -3305,7 +3321,7 @@ void CItemManager::GCItemListSend(int aIndex)
 			{
 				info.slot = n;
 
-				this->ItemByteConvert(info.ItemInfo, lpObj->Inventory[n]);
+				this->ItemByteConvert(info.ItemInfo, &lpObj->Inventory[n]);
 
 				memcpy(&send[size], &info, sizeof(info));
 
@@ -3355,7 +3371,7 @@ void CItemManager::GCItemModifySend(int aIndex, BYTE slot)
 
 	pMsg.slot = slot;
 
-	this->ItemByteConvert(pMsg.ItemInfo, lpObj->Inventory[slot]);
+	this->ItemByteConvert(pMsg.ItemInfo, &lpObj->Inventory[slot]);
 
 	DataSend(aIndex, (BYTE*)&pMsg, pMsg.header.size);
 }
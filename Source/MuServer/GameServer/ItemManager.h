@@ -221,7 +221,7 @@ public:
 
 	void Load(const char* path);
 
-	bool GetInfo(int index, ITEM_INFO* lpInfo);
+	ITEM_INFO* GetInfo(int index);
 
 	int GetItemSkill(int index);
 
@@ -307,7 +307,7 @@ public:
 
 	void ChaosBoxDelItem(int aIndex, int slot);
 
-	void ItemByteConvert(BYTE* lpMsg, CItem item);
+	void ItemByteConvert(BYTE* lpMsg, CItem* lpItem);
 
 	void DBItemByteConvert(BYTE* lpMsg, CItem* lpItem);
 
@@ -379,7 +379,9 @@ public:
 
 private:
 
-	std::map<int, ITEM_INFO> m_ItemInfo;
+	ITEM_INFO m_ItemInfoTable[2][MAX_ITEM];
+
+	ITEM_INFO* m_ItemInfo;
 };
 
 extern CItemManager gItemManager;
@@ -139,7 +139,7 @@ void JGConnectAccountRecv(SDHP_CONNECT_ACCOUNT_RECV* lpMsg)
 
 	gObj[lpMsg->index].AccountLevel = lpMsg->AccountLevel;
 
-	memcpy(gObj[lpMsg->index].AccountExpireDate, lpMsg->AccountExpireDate, sizeof(gObj[lpMsg->index].AccountExpireDate));
+	memcpy(gObj[lpMsg->index].UserData->AccountExpireDate, lpMsg->AccountExpireDate, sizeof(gObj[lpMsg->index].UserData->AccountExpireDate));
 
 	GCConnectAccountSend(lpMsg->index, 1);
 
@@ -202,19 +202,19 @@ void JGAccountLevelRecv(SDHP_ACCOUNT_LEVEL_RECV* lpMsg)
 		return;
 	}
 
-	if (gObj[lpMsg->index].AccountLevel == lpMsg->AccountLevel && strcmp(gObj[lpMsg->index].AccountExpireDate, lpMsg->AccountExpireDate) == 0)
+	if (gObj[lpMsg->index].AccountLevel == lpMsg->AccountLevel && strcmp(gObj[lpMsg->index].UserData->AccountExpireDate, lpMsg->AccountExpireDate) == 0)
 	{
 		gObj[lpMsg->index].AccountLevel = lpMsg->AccountLevel;
 
-		memcpy(gObj[lpMsg->index].AccountExpireDate, lpMsg->AccountExpireDate, sizeof(gObj[lpMsg->index].AccountExpireDate));
+		memcpy(gObj[lpMsg->index].UserData->AccountExpireDate, lpMsg->AccountExpireDate, sizeof(gObj[lpMsg->index].UserData->AccountExpireDate));
 	}
 	else
 	{
 		gObj[lpMsg->index].AccountLevel = lpMsg->AccountLevel;
 
-		memcpy(gObj[lpMsg->index].AccountExpireDate, lpMsg->AccountExpireDate, sizeof(gObj[lpMsg->index].AccountExpireDate));
+		memcpy(gObj[lpMsg->index].UserData->AccountExpireDate, lpMsg->AccountExpireDate, sizeof(gObj[lpMsg->index].UserData->AccountExpireDate));
 
-		gNotice.GCNoticeSend(lpMsg->index, 1, gMessage.GetTextMessage((36 + gObj[lpMsg->index].AccountLevel), gObj[lpMsg->index].Lang), gObj[lpMsg->index].AccountExpireDate);
+		gNotice.GCNoticeSend(lpMsg->index, 1, gMessage.GetTextMessage((36 + gObj[lpMsg->index].AccountLevel), gObj[lpMsg->index].Lang), gObj[lpMsg->index].UserData->AccountExpireDate);
 	}
 }
 
@@ -19,14 +19,40 @@ CMap::CMap()
 
 	this->m_MapAttr = 0;
 
+	memset(this->m_WalkPlane, 0, sizeof(this->m_WalkPlane));
+
+	memset(this->m_SafePlane, 0, sizeof(this->m_SafePlane));
+
+	memset(this->m_StandPlane, 0, sizeof(this->m_StandPlane));
+
+	memset(this->m_WallPlane, 0, sizeof(this->m_WallPlane));
+
+	this->m_NeighborMask = new BYTE[TERRAIN_SIZE * TERRAIN_SIZE];
+
+	this->m_WallCache = new MAP_WALL_CACHE[MAX_MAP_WALL_CACHE];
+
+	memset(this->m_WallCache, 0, sizeof(MAP_WALL_CACHE) * MAX_MAP_WALL_CACHE);
+
+	this->m_WallGeneration = 1;
+
+	memset(this->m_NeighborMask, 0, TERRAIN_SIZE * TERRAIN_SIZE);
+
 	this->m_width = 0;
 
 	this->m_height = 0;
 
 	this->m_path = new CMapPath;
 
+	this->m_flow = new CMapFlow;
+
 	this->m_ItemCount = 0;
 
+	memset(this->m_ActiveRegion, 0, sizeof(this->m_ActiveRegion));
+
+	this->m_ActiveOverride = 1;
+
+	this->m_EventMap = 0;
+
 	SetRect(&this->m_MapRespawn[0], 130, 116, 151, 137);
 	SetRect(&this->m_MapRespawn[1], 106, 236, 112, 243);
 	SetRect(&this->m_MapRespawn[2], 197, 35, 218, 50);
@@ -131,7 +157,11 @@ void CMap::Load(const char* path, int map)
 		return;
 	}
 
-	this->m_path->SetMapDimensions(this->m_width, this->m_height, this->m_MapAttr);
+	this->BuildAttrPlane();
+
+	this->m_path->SetMapDimensions(this->m_width, this->m_height, this->m_MapAttr, this->m_NeighborMask);
+
+	this->m_flow->SetMapDimensions(this->m_width, this->m_height, this->m_MapAttr, this->m_NeighborMask);
 
 	this->m_MapNumber = map;
 
@@ -166,6 +196,13 @@ void CMap::SetAttr(int x, int y, BYTE attr)
 	}
 
 	this->m_MapAttr[(y * this->m_height) + x] |= attr;
+
+	this->UpdateAttrPlane(x, y);
+
+	if ((attr & MAP_ATTR_BLOCK) != 0)
+	{
+		this->m_WallGeneration++;
+	}
 }
 
 void CMap::DelAttr(int x, int y, BYTE attr)
@@ -176,26 +213,23 @@ void CMap::DelAttr(int x, int y, BYTE attr)
 	}
 
 	this->m_MapAttr[(y * this->m_height) + x] &= ~attr;
-}
 
-bool CMap::CheckStandAttr(int x, int y)
-{
-	if (this->CheckAttr(x, y, 2) != false)
-	{
-		return false;
-	}
+	this->UpdateAttrPlane(x, y);
 
-	if (this->CheckAttr(x, y, 4) != false)
+	if ((attr & MAP_ATTR_BLOCK) != 0)
 	{
-		return false;
+		this->m_WallGeneration++;
 	}
+}
 
-	if (this->CheckAttr(x, y, 8) != false)
+bool CMap::CheckStandAttr(int x, int y)
+{
+	if (x < 0 || x >= this->m_width || y < 0 || y >= this->m_height)
 	{
 		return false;
 	}
 
-	return true;
+	return ((this->m_StandPlane[((y * TERRAIN_SIZE) + x) / 32] >> (x % 32)) & 1) != 0;
 }
 
 void CMap::SetStandAttr(int x, int y)
@@ -206,6 +240,8 @@ void CMap::SetStandAttr(int x, int y)
 	}
 
 	this->m_MapAttr[(y * this->m_height) + x] |= 2;
+
+	this->UpdateAttrPlane(x, y);
 }
 
 void CMap::DelStandAttr(int x, int y)
@@ -216,6 +252,101 @@ void CMap::DelStandAttr(int x, int y)
 	}
 
 	this->m_MapAttr[(y * this->m_height) + x] &= ~2;
+
+	this->UpdateAttrPlane(x, y);
+}
+
+bool CMap::CheckWalkAttr(int x, int y)
+{
+	if (x < 0 || x >= this->m_width || y < 0 || y >= this->m_height)
+	{
+		return false;
+	}
+
+	return ((this->m_WalkPlane[((y * TERRAIN_SIZE) + x) / 32] >> (x % 32)) & 1) != 0;
+}
+
+bool CMap::CheckSafeAttr(int x, int y)
+{
+	if (x < 0 || x >= this->m_width || y < 0 || y >= this->m_height)
+	{
+		return false;
+	}
+
+	return ((this->m_SafePlane[((y * TERRAIN_SIZE) + x) / 32] >> (x % 32)) & 1) != 0;
+}
+
+BYTE CMap::GetNeighborMask(int x, int y)
+{
+	if (x < 0 || x >= this->m_width || y < 0 || y >= this->m_height)
+	{
+		return 0;
+	}
+
+	return this->m_NeighborMask[(y * TERRAIN_SIZE) + x];
+}
+
+void CMap::BuildAttrPlane()
+{
+	memset(this->m_WalkPlane, 0, sizeof(this->m_WalkPlane));
+
+	memset(this->m_SafePlane, 0, sizeof(this->m_SafePlane));
+
+	memset(this->m_StandPlane, 0, sizeof(this->m_StandPlane));
+
+	memset(this->m_WallPlane, 0, sizeof(this->m_WallPlane));
+
+	memset(this->m_NeighborMask, 0, TERRAIN_SIZE * TERRAIN_SIZE);
+
+	this->m_WallGeneration++;
+
+	for (int y = 0; y < this->m_height; y++)
+	{
+		for (int x = 0; x < this->m_width; x++)
+		{
+			this->UpdateAttrPlane(x, y);
+		}
+	}
+}
+
+void CMap::UpdateAttrPlane(int x, int y)
+{
+	BYTE attr = this->m_MapAttr[(y * this->m_height) + x];
+
+	int index = ((y * TERRAIN_SIZE) + x) / 32;
+
+	DWORD bit = 1 << (x % 32);
+
+	this->m_WalkPlane[index] = (((attr & (MAP_ATTR_BLOCK | MAP_ATTR_HOLLOW)) == 0) ? (this->m_WalkPlane[index] | bit) : (this->m_WalkPlane[index] & ~bit));
+
+	this->m_SafePlane[index] = (((attr & MAP_ATTR_SAFTYZONE) != 0) ? (this->m_SafePlane[index] | bit) : (this->m_SafePlane[index] & ~bit));
+
+	this->m_StandPlane[index] = (((attr & (MAP_ATTR_STAND | MAP_ATTR_BLOCK | MAP_ATTR_HOLLOW)) == 0) ? (this->m_StandPlane[index] | bit) : (this->m_StandPlane[index] & ~bit));
+
+	this->m_WallPlane[index] = (((attr & MAP_ATTR_BLOCK) != 0) ? (this->m_WallPlane[index] | bit) : (this->m_WallPlane[index] & ~bit));
+
+	static const int NeighborDir[8][2] = {{-1, -1}, {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}};
+
+	for (int n = 0; n < 8; n++)
+	{
+		int nx = x - NeighborDir[n][0];
+
+		int ny = y - NeighborDir[n][1];
+
+		if (nx < 0 || nx >= this->m_width || ny < 0 || ny >= this->m_height)
+		{
+			continue;
+		}
+
+		if (attr <= MAP_ATTR_SAFTYZONE)
+		{
+			this->m_NeighborMask[(ny * TERRAIN_SIZE) + nx] |= (1 << n);
+		}
+		else
+		{
+			this->m_NeighborMask[(ny * TERRAIN_SIZE) + nx] &= ~(1 << n);
+		}
+	}
 }
 
 BYTE CMap::GetWeather()
@@ -272,7 +403,7 @@ void CMap::GetMapPos(int map, short* ox, short* oy)
 
 		int y = this->m_MapRespawn[map].top + (GetLargeRand() % (this->m_MapRespawn[map].bottom - this->m_MapRespawn[map].top));
 
-		if (this->CheckAttr(x, y, 4) == false && this->CheckAttr(x, y, 8) == false)
+		if (this->CheckWalkAttr(x, y) != false)
 		{
 			(*ox) = x;
 
@@ -299,7 +430,7 @@ void CMap::GetMapRandomPos(short* ox, short* oy, int size)
 
 		y = y + (GetLargeRand() % (size * 2));
 
-		if (this->CheckAttr(x, y, 4) == false && this->CheckAttr(x, y, 8) == false)
+		if (this->CheckWalkAttr(x, y) != false)
 		{
 			(*ox) = x;
 
@@ -312,7 +443,7 @@ void CMap::GetMapRandomPos(short* ox, short* oy, int size)
 
 bool CMap::MoneyItemDrop(int money, int x, int y)
 {
-	if (this->CheckAttr(x, y, 4) != false || this->CheckAttr(x, y, 8) != false)
+	if (this->CheckWalkAttr(x, y) == false)
 	{
 		return false;
 	}
@@ -358,7 +489,7 @@ bool CMap::MoneyItemDrop(int money, int x, int y)
 
 bool CMap::MonsterItemDrop(int index, int level, float dur, int x, int y, BYTE SkillOption, BYTE LuckOption, BYTE AddOption, BYTE ExceOption, int aIndex, DWORD serial)
 {
-	if (this->CheckAttr(x, y, 4) != false || this->CheckAttr(x, y, 8) != false)
+	if (this->CheckWalkAttr(x, y) == false)
 	{
 		return false;
 	}
@@ -388,7 +519,7 @@ bool CMap::MonsterItemDrop(int index, int level, float dur, int x, int y, BYTE S
 
 bool CMap::ItemDrop(int index, int level, float dur, int x, int y, BYTE SkillOption, BYTE LuckOption, BYTE AddOption, BYTE ExceOption, DWORD serial, int aIndex)
 {
-	if (this->CheckAttr(x, y, 4) != false || this->CheckAttr(x, y, 8) != false)
+	if (this->CheckWalkAttr(x, y) == false)
 	{
 		return false;
 	}
@@ -532,96 +663,120 @@ void CMap::StateSetDestroy()
 
 BOOL CMap::CheckWall(int sx, int sy, int tx, int ty)
 {
-	int sx1 = sx, sy1 = sy, sx2 = tx, sy2 = ty;
+	if (gServerInfo.m_MapWallCacheSwitch == 0)
+	{
+		return this->CheckWallLine(sx, sy, tx, ty);
+	}
 
-	int Index = ((BYTE)sy1 * 256 + (BYTE)sx1);
+	DWORD key = (BYTE)sx | ((BYTE)sy << 8) | ((BYTE)tx << 16) | ((DWORD)(BYTE)ty << 24);
 
-	int nx1;
+	MAP_WALL_CACHE* lpCache = &this->m_WallCache[(key * 2654435761u) >> 22];
 
-	int ny1;
+	for (int n = 0; n < 2; n++)
+	{
+		if (lpCache->Key[n] == key && lpCache->Generation[n] == this->m_WallGeneration)
+		{
+			lpCache->Last = n;
 
-	int d1;
+			return lpCache->Result[n];
+		}
+	}
 
-	int d2;
+	int slot = lpCache->Last ^ 1;
 
-	int len1;
+	lpCache->Key[slot] = key;
 
-	int len2;
+	lpCache->Generation[slot] = this->m_WallGeneration;
 
-	int px1 = sx2 - sx1;
+	lpCache->Result[slot] = this->CheckWallLine(sx, sy, tx, ty);
 
-	int py1 = sy2 - sy1;
+	lpCache->Last = slot;
 
-	if (px1 < 0)
-	{
-		px1 = -px1;
+	return lpCache->Result[slot];
+}
 
-		nx1 = -1;
-	}
-	else
-	{
-		nx1 = 1;
-	}
+BOOL CMap::CheckWallLine(int sx, int sy, int tx, int ty)
+{
+	int x = (BYTE)sx;
 
-	if (py1 < 0)
-	{
-		py1 = -py1;
+	int y = (BYTE)sy;
 
-		ny1 = -256;
-	}
-	else
+	int ex = x + (tx - sx);
+
+	int ey = y + (ty - sy);
+
+	if (ex < 0 || ex > TERRAIN_SIZE_MASK || ey < 0 || ey > TERRAIN_SIZE_MASK)
 	{
-		ny1 = 256;
+		return FALSE;
 	}
 
-	if (px1 > py1)
-	{
-		len1 = px1;
+	int px = abs(ex - x);
 
-		len2 = py1;
+	int py = abs(ey - y);
 
-		d1 = ny1;
+	int nx = ((ex < x) ? -1 : 1);
 
-		d2 = nx1;
-	}
-	else
+	int ny = ((ey < y) ? -1 : 1);
+
+	int error = 0;
+
+	if (px > py)
 	{
-		len1 = py1;
+		int word = ((y * TERRAIN_SIZE) + x) / 32;
 
-		len2 = px1;
+		DWORD mask = 0;
 
-		d1 = nx1;
+		for (int count = 0; count <= px; count++)
+		{
+			int index = ((y * TERRAIN_SIZE) + x) / 32;
 
-		d2 = ny1;
-	}
+			if (index != word)
+			{
+				if ((this->m_WallPlane[word] & mask) != 0)
+				{
+					return FALSE;
+				}
 
-	int error = 0;
+				word = index;
 
-	int count = 0;
+				mask = 0;
+			}
 
-	int Shadow = 0;
+			mask |= 1 << (x % 32);
 
-	do
+			error += py;
+
+			if (error > (px / 2))
+			{
+				y += ny;
+
+				error -= px;
+			}
+
+			x += nx;
+		}
+
+		return ((this->m_WallPlane[word] & mask) == 0);
+	}
+
+	for (int count = 0; count <= py; count++)
 	{
-		if ((this->m_MapAttr[Index] & 4) == 4)
+		if (((this->m_WallPlane[((y * TERRAIN_SIZE) + x) / 32] >> (x % 32)) & 1) != 0)
 		{
 			return FALSE;
 		}
 
-		error += len2;
+		error += px;
 
-		if (error > len1 / 2)
+		if (error > (py / 2))
 		{
-			Index += d1;
+			x += nx;
 
-			error -= len1;
+			error -= py;
 		}
 
-		Index += d2;
-
-		count++;
+		y += ny;
 	}
-	while (count <= len1);
 
 	return TRUE;
 }
@@ -740,12 +895,7 @@ bool CMap::PathFinding2(int sx, int sy, int tx, int ty, PATH_INFO* path)
 {
 	PATH_INFO* a = path;
 
-	bool Success = this->m_path->FindPath(sx, sy, tx, ty, true);
-
-	if (Success == false)
-	{
-		Success = this->m_path->FindPath(sx, sy, tx, ty, false);
-	}
+	bool Success = this->m_path->FindPath(sx, sy, tx, ty);
 
 	if (Success != false)
 	{
@@ -780,12 +930,7 @@ bool CMap::PathFinding3(int sx, int sy, int tx, int ty, PATH_INFO* path)
 {
 	PATH_INFO* a = path;
 
-	bool Success = this->m_path->FindPath2(sx, sy, tx, ty, TRUE);
-
-	if (Success == false)
-	{
-		Success = this->m_path->FindPath2(sx, sy, tx, ty, FALSE);
-	}
+	bool Success = this->m_path->FindPath2(sx, sy, tx, ty);
 
 	if (Success != false)
 	{
@@ -820,12 +965,7 @@ bool CMap::PathFinding4(int sx, int sy, int tx, int ty, PATH_INFO* path)
 {
 	PATH_INFO* a = path;
 
-	bool Success = this->m_path->FindPath3(sx, sy, tx, ty, true);
-
-	if (Success == false)
-	{
-		Success = this->m_path->FindPath3(sx, sy, tx, ty, false);
-	}
+	bool Success = this->m_path->FindPath3(sx, sy, tx, ty);
 
 	if (Success != false)
 	{
@@ -855,3 +995,69 @@ bool CMap::PathFinding4(int sx, int sy, int tx, int ty, PATH_INFO* path)
 
 	return false;
 }
+
+bool CMap::PathFindingFlow(int sx, int sy, int index, int tx, int ty, int mtx, int mty, int range, PATH_INFO* path)
+{
+	if (this->m_flow->FindPath(sx, sy, index, tx, ty, mtx, mty, range) == false)
+	{
+		return false;
+	}
+
+	path->PathNum = this->m_flow->GetPath();
+
+	BYTE* px = this->m_flow->GetPathX();
+
+	BYTE* py = this->m_flow->GetPathY();
+
+	for (int n = 0; n < path->PathNum; n++)
+	{
+		path->PathX[n] = px[n];
+
+		path->PathY[n] = py[n];
+	}
+
+	path->CurrentPath = 0;
+
+	return true;
+}
+
+void CMap::ClearActiveRegion(bool override)
+{
+	memset(this->m_ActiveRegion, 0, sizeof(this->m_ActiveRegion));
+
+	this->m_ActiveOverride = override;
+}
+
+void CMap::SetActiveRegion(int x, int y, int range)
+{
+	int sx = ((x - range) < 0) ? 0 : ((x - range) / MAP_REGION_SIZE);
+
+	int sy = ((y - range) < 0) ? 0 : ((y - range) / MAP_REGION_SIZE);
+
+	int tx = ((x + range) > TERRAIN_SIZE_MASK) ? (MAX_MAP_REGION - 1) : ((x + range) / MAP_REGION_SIZE);
+
+	int ty = ((y + range) > TERRAIN_SIZE_MASK) ? (MAX_MAP_REGION - 1) : ((y + range) / MAP_REGION_SIZE);
+
+	for (int ry = sy; ry <= ty; ry++)
+	{
+		for (int rx = sx; rx <= tx; rx++)
+		{
+			this->m_ActiveRegion[ry][rx] = 1;
+		}
+	}
+}
+
+bool CMap::CheckActiveRegion(int x, int y)
+{
+	if (this->m_ActiveOverride != 0)
+	{
+		return 1;
+	}
+
+	if (x < 0 || x > TERRAIN_SIZE_MASK || y < 0 || y > TERRAIN_SIZE_MASK)
+	{
+		return 1;
+	}
+
+	return (this->m_ActiveRegion[y / MAP_REGION_SIZE][x / MAP_REGION_SIZE] != 0);
+}
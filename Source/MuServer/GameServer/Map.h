@@ -1,5 +1,6 @@
 #pragma once
 
+#include "MapFlow.h"
 #include "MapItem.h"
 #include "MapPath.h"
 
@@ -9,6 +10,10 @@
 #define MAX_MAP_HEIGHT 256
 #define TERRAIN_SIZE_MASK 255
 #define TERRAIN_SIZE 256
+#define MAP_PLANE_SIZE ((TERRAIN_SIZE * TERRAIN_SIZE) / 32)
+#define MAP_REGION_SIZE 16
+#define MAX_MAP_WALL_CACHE 1024
+#define MAX_MAP_REGION (TERRAIN_SIZE/MAP_REGION_SIZE)
 
 #define MAP_ATTR_NONE		0x00 // Map attribute - none
 #define MAP_ATTR_SAFTYZONE	0x01 // Map attribute - safe zone
@@ -23,6 +28,14 @@
 #define DS_MAP_RANGE(x) (((x) == MAP_DEVIL_SQUARE1) ? 1 : 0)
 #define BC_MAP_RANGE(x) (((x) < MAP_BLOOD_CASTLE1) ? 0 : ((x) > MAP_BLOOD_CASTLE6) ? 0 : 1)
 
+struct MAP_WALL_CACHE
+{
+	DWORD Key[2];
+	DWORD Generation[2];
+	BYTE Result[2];
+	BYTE Last;
+};
+
 enum eMapNumber
 {
 	MAP_LORENCIA = 0,
@@ -68,6 +81,16 @@ public:
 
 	void DelStandAttr(int x, int y);
 
+	bool CheckWalkAttr(int x, int y);
+
+	bool CheckSafeAttr(int x, int y);
+
+	BYTE GetNeighborMask(int x, int y);
+
+	void BuildAttrPlane();
+
+	void UpdateAttrPlane(int x, int y);
+
 	BYTE GetWeather();
 
 	void SetWeather(BYTE weather, BYTE variation);
@@ -96,12 +119,22 @@ public:
 
 	BYTE CheckWall2(int sx, int sy, int tx, int ty);
 
+	BOOL CheckWallLine(int sx, int sy, int tx, int ty);
+
 	bool PathFinding2(int sx, int sy, int tx, int ty, PATH_INFO* path);
 
 	bool PathFinding3(int sx, int sy, int tx, int ty, PATH_INFO* path);
 
 	bool PathFinding4(int sx, int sy, int tx, int ty, PATH_INFO* path);
 
+	bool PathFindingFlow(int sx, int sy, int index, int tx, int ty, int mtx, int mty, int range, PATH_INFO* path);
+
+	void ClearActiveRegion(bool override);
+
+	void SetActiveRegion(int x, int y, int range);
+
+	bool CheckActiveRegion(int x, int y);
+
 public:
 
 	BYTE m_Weather;
@@ -114,12 +147,28 @@ public:
 
 	BYTE* m_MapAttr;
 
+	DWORD m_WalkPlane[MAP_PLANE_SIZE];
+
+	DWORD m_SafePlane[MAP_PLANE_SIZE];
+
+	DWORD m_StandPlane[MAP_PLANE_SIZE];
+
+	DWORD m_WallPlane[MAP_PLANE_SIZE];
+
+	MAP_WALL_CACHE* m_WallCache;
+
+	DWORD m_WallGeneration;
+
+	BYTE* m_NeighborMask;
+
 	int m_width;
 
 	int m_height;
 
 	CMapPath* m_path;
 
+	CMapFlow* m_flow;
+
 	CMapItem m_Item[MAX_MAP_ITEM];
 
 	RECT m_MapRespawn[MAX_MAP];
@@ -127,6 +176,12 @@ public:
 	int m_MapNumber;
 
 	int m_ItemCount;
+
+	BYTE m_ActiveRegion[MAX_MAP_REGION][MAX_MAP_REGION];
+
+	bool m_ActiveOverride;
+
+	bool m_EventMap;
 };
 
 extern CMap gMap[MAX_MAP];
@@ -0,0 +1,298 @@
+#include "stdafx.h"
+#include "MapFlow.h"
+#include "Map.h"
+
+CMapFlow::CMapFlow()
+{
+	this->m_PathDir[0] = -1;
+
+	this->m_PathDir[1] = -1;
+
+	this->m_PathDir[2] = 0;
+
+	this->m_PathDir[3] = -1;
+
+	this->m_PathDir[4] = 1;
+
+	this->m_PathDir[5] = -1;
+
+	this->m_PathDir[6] = 1;
+
+	this->m_PathDir[7] = 0;
+
+	this->m_PathDir[8] = 1;
+
+	this->m_PathDir[9] = 1;
+
+	this->m_PathDir[10] = 0;
+
+	this->m_PathDir[11] = 1;
+
+	this->m_PathDir[12] = -1;
+
+	this->m_PathDir[13] = 1;
+
+	this->m_PathDir[14] = -1;
+
+	this->m_PathDir[15] = 0;
+
+	this->m_width = 0;
+
+	this->m_height = 0;
+
+	this->m_NumPath = 0;
+
+	this->m_MapAttr = 0;
+
+	this->m_NeighborMask = 0;
+
+	for (int n = 0; n < MAX_MAP_FLOW_FIELD; n++)
+	{
+		this->m_Field[n].TargetIndex = -1;
+
+		this->m_Field[n].TargetX = -1;
+
+		this->m_Field[n].TargetY = -1;
+
+		this->m_Field[n].Time = 0;
+	}
+}
+
+CMapFlow::~CMapFlow()
+{
+
+}
+
+void CMapFlow::SetMapDimensions(int width, int height, BYTE* MapAttr, BYTE* NeighborMask)
+{
+	this->m_width = width;
+
+	this->m_height = height;
+
+	this->m_MapAttr = MapAttr;
+
+	this->m_NeighborMask = NeighborMask;
+}
+
+bool CMapFlow::FindPath(int startx, int starty, int index, int targetx, int targety, int mtx, int mty, int range)
+{
+	this->m_NumPath = 0;
+
+	if (this->m_MapAttr == 0)
+	{
+		return false;
+	}
+
+	if (targetx < 0 || targetx >= this->m_width || targety < 0 || targety >= this->m_height)
+	{
+		return false;
+	}
+
+	if (abs(startx - targetx) > (MAP_FLOW_RANGE - MAP_FLOW_CELL) || abs(starty - targety) > (MAP_FLOW_RANGE - MAP_FLOW_CELL))
+	{
+		return false;
+	}
+
+	MAP_FLOW_FIELD* lpField = this->GetField(index, targetx, targety);
+
+	int OriginX = lpField->TargetX - MAP_FLOW_RANGE;
+
+	int OriginY = lpField->TargetY - MAP_FLOW_RANGE;
+
+	int x = startx;
+
+	int y = starty;
+
+	int node = ((y - OriginY) * MAP_FLOW_SIZE) + (x - OriginX);
+
+	if (lpField->Dist[node] == MAP_FLOW_NONE)
+	{
+		return false;
+	}
+
+	this->m_PathX[this->m_NumPath] = x;
+
+	this->m_PathY[this->m_NumPath] = y;
+
+	this->m_NumPath++;
+
+	while (this->m_NumPath <= MAX_PATH_STEP)
+	{
+		if ((abs(x - targetx) <= range && abs(y - targety) <= range) || (x == mtx && y == mty))
+		{
+			break;
+		}
+
+		int BestNode = -1;
+
+		int BestDir = 0;
+
+		BYTE mask = this->m_NeighborMask[(y * TERRAIN_SIZE) + x];
+
+		for (int n = 0; n < 8; n++)
+		{
+			if ((mask & (1 << n)) == 0)
+			{
+				continue;
+			}
+
+			int nx = x + this->m_PathDir[n * 2];
+
+			int ny = y + this->m_PathDir[n * 2 + 1];
+
+			if (abs(nx - lpField->TargetX) > MAP_FLOW_RANGE || abs(ny - lpField->TargetY) > MAP_FLOW_RANGE)
+			{
+				continue;
+			}
+
+			int next = ((ny - OriginY) * MAP_FLOW_SIZE) + (nx - OriginX);
+
+			if (lpField->Dist[next] >= lpField->Dist[(BestNode == -1) ? node : BestNode])
+			{
+				continue;
+			}
+
+			BestNode = next;
+
+			BestDir = n;
+		}
+
+		if (BestNode == -1)
+		{
+			break;
+		}
+
+		x += this->m_PathDir[BestDir * 2];
+
+		y += this->m_PathDir[BestDir * 2 + 1];
+
+		node = BestNode;
+
+		this->m_PathX[this->m_NumPath] = x;
+
+		this->m_PathY[this->m_NumPath] = y;
+
+		this->m_NumPath++;
+	}
+
+	return (this->m_NumPath > 1);
+}
+
+MAP_FLOW_FIELD* CMapFlow::GetField(int index, int targetx, int targety)
+{
+	// A field belongs to the chased object and is centered on the cell it
+	// stood on. It is rebuilt in place once the target leaves that cell by
+	// more than MAP_FLOW_CELL or the field expires.
+
+	MAP_FLOW_FIELD* lpOldest = &this->m_Field[0];
+
+	for (int n = 0; n < MAX_MAP_FLOW_FIELD; n++)
+	{
+		MAP_FLOW_FIELD* lpField = &this->m_Field[n];
+
+		if (lpField->TargetIndex == index)
+		{
+			if ((GetTickCount() - lpField->Time) < MAP_FLOW_TIME && abs(lpField->TargetX - targetx) <= MAP_FLOW_CELL && abs(lpField->TargetY - targety) <= MAP_FLOW_CELL)
+			{
+				return lpField;
+			}
+
+			lpOldest = lpField;
+
+			break;
+		}
+
+		if ((GetTickCount() - lpField->Time) > (GetTickCount() - lpOldest->Time))
+		{
+			lpOldest = lpField;
+		}
+	}
+
+	lpOldest->TargetIndex = index;
+
+	lpOldest->TargetX = targetx;
+
+	lpOldest->TargetY = targety;
+
+	lpOldest->Time = GetTickCount();
+
+	this->BuildField(lpOldest);
+
+	return lpOldest;
+}
+
+void CMapFlow::BuildField(MAP_FLOW_FIELD* lpField)
+{
+	memset(lpField->Dist, 0xFF, sizeof(lpField->Dist));
+
+	int OriginX = lpField->TargetX - MAP_FLOW_RANGE;
+
+	int OriginY = lpField->TargetY - MAP_FLOW_RANGE;
+
+	int head = 0;
+
+	int tail = 0;
+
+	int start = (MAP_FLOW_RANGE * MAP_FLOW_SIZE) + MAP_FLOW_RANGE;
+
+	lpField->Dist[start] = 0;
+
+	this->m_Queue[tail++] = start;
+
+	while (head < tail)
+	{
+		int node = this->m_Queue[head++];
+
+		int x = OriginX + (node % MAP_FLOW_SIZE);
+
+		int y = OriginY + (node / MAP_FLOW_SIZE);
+
+		for (int n = 0; n < 8; n++)
+		{
+			int nx = x + this->m_PathDir[n * 2];
+
+			int ny = y + this->m_PathDir[n * 2 + 1];
+
+			if ((nx - OriginX) < 0 || (nx - OriginX) >= MAP_FLOW_SIZE || (ny - OriginY) < 0 || (ny - OriginY) >= MAP_FLOW_SIZE)
+			{
+				continue;
+			}
+
+			if (nx < 0 || nx >= this->m_width || ny < 0 || ny >= this->m_height)
+			{
+				continue;
+			}
+
+			int next = ((ny - OriginY) * MAP_FLOW_SIZE) + (nx - OriginX);
+
+			if (lpField->Dist[next] != MAP_FLOW_NONE)
+			{
+				continue;
+			}
+
+			if ((this->m_MapAttr[nx + ny * this->m_width] & ~MAP_ATTR_STAND) > MAP_ATTR_SAFTYZONE)
+			{
+				continue;
+			}
+
+			lpField->Dist[next] = lpField->Dist[node] + 1;
+
+			this->m_Queue[tail++] = next;
+		}
+	}
+}
+
+int CMapFlow::GetPath()
+{
+	return this->m_NumPath;
+}
+
+BYTE* CMapFlow::GetPathX()
+{
+	return this->m_PathX;
+}
+
+BYTE* CMapFlow::GetPathY()
+{
+	return this->m_PathY;
+}
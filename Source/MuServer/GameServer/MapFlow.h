@@ -0,0 +1,67 @@
+#pragma once
+
+#include "MapPath.h"
+
+#define MAX_MAP_FLOW_FIELD 8
+#define MAP_FLOW_RANGE 24
+#define MAP_FLOW_SIZE ((MAP_FLOW_RANGE * 2) + 1)
+#define MAX_MAP_FLOW_NODE (MAP_FLOW_SIZE * MAP_FLOW_SIZE)
+#define MAP_FLOW_TIME 500
+#define MAP_FLOW_CELL 2
+#define MAP_FLOW_NONE 0xFFFF
+
+struct MAP_FLOW_FIELD
+{
+	int TargetIndex;
+	int TargetX;
+	int TargetY;
+	DWORD Time;
+	WORD Dist[MAX_MAP_FLOW_NODE];
+};
+
+class CMapFlow
+{
+public:
+
+	CMapFlow();
+
+	~CMapFlow();
+
+	void SetMapDimensions(int width, int height, BYTE* MapAttr, BYTE* NeighborMask);
+
+	bool FindPath(int startx, int starty, int index, int targetx, int targety, int mtx, int mty, int range);
+
+	int GetPath();
+
+	BYTE* GetPathX();
+
+	BYTE* GetPathY();
+
+private:
+
+	MAP_FLOW_FIELD* GetField(int index, int targetx, int targety);
+
+	void BuildField(MAP_FLOW_FIELD* lpField);
+
+private:
+
+	int m_width;
+
+	int m_height;
+
+	int m_NumPath;
+
+	BYTE m_PathX[MAX_PATH_STEP + 1];
+
+	BYTE m_PathY[MAX_PATH_STEP + 1];
+
+	int m_PathDir[16];
+
+	BYTE* m_MapAttr;
+
+	BYTE* m_NeighborMask;
+
+	MAP_FLOW_FIELD m_Field[MAX_MAP_FLOW_FIELD];
+
+	short m_Queue[MAX_MAP_FLOW_NODE];
+};
@@ -1,5 +1,7 @@
 #include "stdafx.h"
 #include "MapPath.h"
+#include "Map.h"
+#include "ServerInfo.h"
 
 CMapPath::CMapPath()
 {
@@ -34,804 +36,288 @@ CMapPath::CMapPath()
 	this->m_PathDir[14] = -1;
 
 	this->m_PathDir[15] = 0;
-}
 
-CMapPath::~CMapPath()
-{
+	this->m_width = 0;
 
-}
+	this->m_height = 0;
 
-int CMapPath::GetDist(int x1, int y1, int x2, int y2)
-{
-	int distx = x2 - x1;
-
-	int disty = y2 - y1;
-
-	return (distx * distx) + (disty * disty);
-}
-
-int CMapPath::VerifyThatOnPath(int x, int y)
-{
-	for (int i = 0; i < this->m_NumPath; i++)
-	{
-		if (x == this->m_PathX[i] && y == this->m_PathY[i])
-		{
-			return i;
-		}
-	}
-
-	return -1;
-}
+	this->m_NumPath = 0;
 
-BOOL CMapPath::CanWeMoveForward(int x, int y)
-{
-	int which = x + y * this->m_width;
+	this->m_MapAttr = 0;
 
-	if (x >= this->m_width || x < 0 || y >= this->m_height || y < 0)
-	{
-		return FALSE;
-	}
+	this->m_NeighborMask = 0;
 
-	if (this->m_MapAttr[which] > 1 || this->m_HitAttr[which] != 0)
-	{
-		this->m_HitAttr[which] = 1;
+	this->m_Generation = 0;
 
-		return FALSE;
-	}
+	memset(this->m_NodeGeneration, 0, sizeof(this->m_NodeGeneration));
 
-	return TRUE;
+	this->m_HeapCount = 0;
 }
 
-BOOL CMapPath::CanWeMoveForward2(int x, int y)
+CMapPath::~CMapPath()
 {
-	int which = x + y * this->m_width;
-
-	if (x >= this->m_width || x < 0 || y >= this->m_height || y < 0)
-	{
-		return FALSE;
-	}
 
-	if (this->m_MapAttr[which] >= 1 || this->m_HitAttr[which] != 0)
-	{
-		this->m_HitAttr[which] = 1;
-
-		return FALSE;
-	}
-
-	return TRUE;
 }
 
-BOOL CMapPath::CanWeMoveForward3(int x, int y)
+int CMapPath::GetDist(int x1, int y1, int x2, int y2)
 {
-	int which = x + y * this->m_width;
+	int distx = abs(x2 - x1);
 
-	if (x >= this->m_width || x < 0 || y >= this->m_height || y < 0)
-	{
-		return FALSE;
-	}
-
-	if (this->m_MapAttr[which] >= 1 || this->m_HitAttr[which] != 0)
-	{
-		this->m_HitAttr[which] = 1;
-
-		return FALSE;
-	}
+	int disty = abs(y2 - y1);
 
-	return TRUE;
+	return ((distx > disty) ? ((distx * 10) + (disty * 4)) : ((disty * 10) + (distx * 4)));
 }
 
-BOOL CMapPath::IsThisSpotOK(int x, int y)
+bool CMapPath::FindPathNode(int startx, int starty, int endx, int endy, BYTE MaxAttr, bool strict)
 {
-	int pos;
-
-	pos = x + y * this->m_width;
-
-	if (x < 0 || x >= this->m_width || y < 0 || y >= this->m_height)
-	{
-		return FALSE;
-	}
+	this->m_NumPath = 0;
 
-	if (this->m_HitAttr[pos] != 0)
+	if (startx < 0 || startx >= this->m_width || starty < 0 || starty >= this->m_height)
 	{
-		return FALSE;
+		return false;
 	}
 
-	return true;
-}
-
-int CMapPath::FindNextDir(int sx, int sy, int dx, int dy, int dirstart, bool First, bool ErrorCheck)
-{
-	int MinDist = 10000000;
-
-	long ldir;
-
-	int WhichDir = 0;
-
-	int i;
-
-	if (First != 0)
+	if (strict != 0 && (abs(endx - startx) > MAX_PATH_STEP || abs(endy - starty) > MAX_PATH_STEP))
 	{
-		for (i = 0; i < 8; i++)
-		{
-			ldir = i % 8;
-
-			int endx = sx + this->m_PathDir[ldir * 2];
-
-			int endy = sy + this->m_PathDir[ldir * 2 + 1];
-
-			int dist = this->GetDist(endx, endy, dx, dy);
-
-			if (MinDist > dist)
-			{
-				if (this->IsThisSpotOK(endx, endy) != FALSE)
-				{
-					MinDist = dist;
-
-					WhichDir = ldir;
-				}
-			}
-		}
+		return false;
 	}
-	else
-	{
-		for (i = dirstart + 7; i <= dirstart + 9; i++)
-		{
-			ldir = i % 8;
 
-			int endx = sx + this->m_PathDir[ldir * 2];
+	this->NextGeneration();
 
-			int endy = sy + this->m_PathDir[ldir * 2 + 1];
+	int OriginX = startx - MAX_PATH_STEP;
 
-			int dist = this->GetDist(endx, endy, dx, dy);
+	int OriginY = starty - MAX_PATH_STEP;
 
-			if (MinDist > dist)
-			{
-				if (this->IsThisSpotOK(endx, endy) != FALSE)
-				{
-					MinDist = dist;
+	int start = (MAX_PATH_STEP * MAX_PATH_RANGE) + MAX_PATH_STEP;
 
-					WhichDir = ldir;
-				}
-			}
-		}
+	this->m_NodeGeneration[start] = this->m_Generation;
 
-		if (MinDist == 10000000)
-		{
-			for (i = dirstart + 2; i <= dirstart + 6; i++)
-			{
-				ldir = i % 8;
+	this->m_NodeCost[start] = 0;
 
-				int endx = sx + this->m_PathDir[ldir * 2];
+	this->m_NodeStep[start] = 0;
 
-				int endy = sy + this->m_PathDir[ldir * 2 + 1];
+	this->m_NodeClosed[start] = 0;
 
-				int dist = this->GetDist(endx, endy, dx, dy);
+	int best = start;
 
-				if (MinDist > dist)
-				{
-					if (this->IsThisSpotOK(endx, endy) != FALSE)
-					{
-						MinDist = dist;
+	int BestDist = this->GetDist(startx, starty, endx, endy);
 
-						WhichDir = ldir;
-					}
-				}
-			}
-		}
-	}
-
-	int LastDist;
+	this->PushNode(start, BestDist);
 
-	this->m_LastDir = dirstart;
+	int budget = ((gServerInfo.m_MonsterPathNodeBudget <= 0) ? MAX_PATH_NODE : gServerInfo.m_MonsterPathNodeBudget);
 
-	LastDist = this->GetDist(sx, sy, sx + this->m_PathDir[this->m_LastDir * 2], sy + this->m_PathDir[this->m_LastDir * 2 + 1]);
-
-	if ((LastDist > MinDist - 6) && (LastDist < MinDist + 6) && (MinDist >= 25))
+	while (this->m_HeapCount > 0 && budget > 0)
 	{
-		WhichDir = this->m_LastDir;
-	}
-
-	if (MinDist == 10000000)
-	{
-		return -1;
-	}
+		int node = this->PopNode();
 
-	if (this->CanWeMoveForward(sx + this->m_PathDir[((WhichDir * 2))], sy + this->m_PathDir[((WhichDir * 2)) + 1]) != FALSE)
-	{
-		int path = this->VerifyThatOnPath(sx, sy);
-
-		if (path != -1)
+		if (this->m_NodeClosed[node] != 0)
 		{
-			this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-			this->m_NumPath = path;
+			continue;
 		}
 
-		return WhichDir;
-	}
+		this->m_NodeClosed[node] = 1;
 
-	if (ErrorCheck != 0)
-	{
-		int dir = WhichDir + 7;
+		budget--;
 
-		dir %= 8;
+		int x = OriginX + (node % MAX_PATH_RANGE);
 
-		if (this->CanWeMoveForward(sx + this->m_PathDir[dir * 2], sy + this->m_PathDir[dir * 2 + 1]) != FALSE)
-		{
-			int path = this->VerifyThatOnPath(sx, sy);
+		int y = OriginY + (node / MAX_PATH_RANGE);
 
-			if (path != -1)
-			{
-				this->m_HitAttr[sx + sy * this->m_width] = 1;
+		int dist = this->GetDist(x, y, endx, endy);
 
-				this->m_NumPath = path;
-			}
+		if (dist < BestDist || (dist == BestDist && this->m_NodeCost[node] < this->m_NodeCost[best]))
+		{
+			best = node;
 
-			return dir;
+			BestDist = dist;
 		}
 
-		int dir2 = WhichDir + 9;
-
-		dir2 %= 8;
-
-		if (CanWeMoveForward(sx + this->m_PathDir[dir2 * 2], sy + this->m_PathDir[dir2 * 2 + 1]) != FALSE)
+		if (dist == 0 || this->m_NodeStep[node] >= MAX_PATH_STEP)
 		{
-			int path = this->VerifyThatOnPath(sx, sy);
-
-			if (path != -1)
+			if (dist == 0)
 			{
-				this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-				this->m_NumPath = path;
+				break;
 			}
 
-			return dir2;
+			continue;
 		}
-	}
-
-	this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-	return -1;
-}
-
-int CMapPath::FindNextDir2(int sx, int sy, int dx, int dy, int dirstart, bool First, bool ErrorCheck)
-{
-	int MinDist = 10000000;
-
-	long ldir;
 
-	int WhichDir = 0;
+		BYTE mask = ((MaxAttr == MAP_ATTR_SAFTYZONE) ? this->m_NeighborMask[(y * TERRAIN_SIZE) + x] : 0xFF);
 
-	int i;
-
-	if (First != 0)
-	{
-		for (i = 0; i < 8; i++)
+		for (int n = 0; n < 8; n++)
 		{
-			ldir = i % 8;
-
-			int endx = sx + this->m_PathDir[ldir * 2];
-
-			int endy = sy + this->m_PathDir[ldir * 2 + 1];
-
-			int dist = this->GetDist(endx, endy, dx, dy);
-
-			if (MinDist > dist)
+			if ((mask & (1 << n)) == 0)
 			{
-				if (this->IsThisSpotOK(endx, endy) != FALSE)
-				{
-					MinDist = dist;
-
-					WhichDir = ldir;
-				}
+				continue;
 			}
-		}
-	}
-	else
-	{
-		for (i = dirstart + 7; i <= dirstart + 9; i++)
-		{
-			ldir = i % 8;
-
-			int endx = sx + this->m_PathDir[ldir * 2];
 
-			int endy = sy + this->m_PathDir[ldir * 2 + 1];
+			int nx = x + this->m_PathDir[n * 2];
 
-			int dist = this->GetDist(endx, endy, dx, dy);
+			int ny = y + this->m_PathDir[n * 2 + 1];
 
-			if (MinDist > dist)
+			if (MaxAttr != MAP_ATTR_SAFTYZONE)
 			{
-				if (this->IsThisSpotOK(endx, endy) != FALSE)
+				if (nx < 0 || nx >= this->m_width || ny < 0 || ny >= this->m_height)
 				{
-					MinDist = dist;
-
-					WhichDir = ldir;
+					continue;
 				}
-			}
-		}
-
-		if (MinDist == 10000000)
-		{
-			for (i = dirstart + 2; i <= dirstart + 6; i++)
-			{
-				ldir = i % 8;
-
-				int endx = sx + this->m_PathDir[ldir * 2];
 
-				int endy = sy + this->m_PathDir[ldir * 2 + 1];
-
-				int dist = this->GetDist(endx, endy, dx, dy);
-
-				if (MinDist > dist)
+				if (this->m_MapAttr[nx + ny * this->m_width] > MaxAttr)
 				{
-					if (this->IsThisSpotOK(endx, endy) != FALSE)
-					{
-						MinDist = dist;
-
-						WhichDir = ldir;
-					}
+					continue;
 				}
 			}
-		}
-	}
-
-	int LastDist;
-
-	this->m_LastDir = dirstart;
-
-	LastDist = this->GetDist(sx, sy, sx + this->m_PathDir[this->m_LastDir * 2], sy + this->m_PathDir[this->m_LastDir * 2 + 1]);
-
-	if ((LastDist > MinDist - 6) && (LastDist < MinDist + 6) && (MinDist >= 25))
-	{
-		WhichDir = this->m_LastDir;
-	}
 
-	if (MinDist == 10000000)
-	{
-		return -1;
-	}
-
-	if (this->CanWeMoveForward2(sx + this->m_PathDir[WhichDir * 2], sy + this->m_PathDir[WhichDir * 2 + 1]) != FALSE)
-	{
-		int path = this->VerifyThatOnPath(sx, sy);
-
-		if (path != -1)
-		{
-			this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-			this->m_NumPath = path;
-		}
-
-		return WhichDir;
-	}
+			int next = node + (this->m_PathDir[n * 2 + 1] * MAX_PATH_RANGE) + this->m_PathDir[n * 2];
 
-	if (ErrorCheck != 0)
-	{
-		int dir = WhichDir + 7;
-
-		dir %= 8;
-
-		if (this->CanWeMoveForward2(sx + this->m_PathDir[dir * 2], sy + this->m_PathDir[dir * 2 + 1]) != FALSE)
-		{
-			int path = this->VerifyThatOnPath(sx, sy);
-
-			if (path != -1)
+			if (this->m_NodeGeneration[next] != this->m_Generation)
 			{
-				this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-				this->m_NumPath = path;
-			}
-
-			return dir;
-		}
-
-		int dir2 = WhichDir + 9;
+				this->m_NodeGeneration[next] = this->m_Generation;
 
-		dir2 %= 8;
+				this->m_NodeCost[next] = 0xFFFF;
 
-		if (this->CanWeMoveForward2(sx + this->m_PathDir[dir2 * 2], sy + this->m_PathDir[dir2 * 2 + 1]) != FALSE)
-		{
-			int path = this->VerifyThatOnPath(sx, sy);
-
-			if (path != -1)
-			{
-				this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-				this->m_NumPath = path;
+				this->m_NodeClosed[next] = 0;
 			}
 
-			return dir2;
-		}
-	}
-
-	this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-	return -1;
-}
-
-int CMapPath::FindNextDir3(int sx, int sy, int dx, int dy, int dirstart, bool First, bool ErrorCheck)
-{
-	int MinDist = 10000000;
-
-	long ldir;
-
-	int WhichDir = 0;
-
-	int i;
-
-	if (First != 0)
-	{
-		for (i = 0; i < 8; i++)
-		{
-			ldir = i % 8;
-
-			int endx = sx + this->m_PathDir[ldir * 2];
-
-			int endy = sy + this->m_PathDir[ldir * 2 + 1];
-
-			int dist = this->GetDist(endx, endy, dx, dy);
-
-			if (MinDist > dist)
+			if (this->m_NodeClosed[next] != 0)
 			{
-				if (this->IsThisSpotOK(endx, endy) != FALSE && this->CanWeMoveForward3(endx, endy) != FALSE)
-				{
-					MinDist = dist;
-
-					WhichDir = ldir;
-				}
+				continue;
 			}
-		}
-	}
-	else
-	{
-		for (i = dirstart + 7; i <= dirstart + 9; i++)
-		{
-			ldir = i % 8;
-
-			int endx = sx + this->m_PathDir[ldir * 2];
 
-			int endy = sy + this->m_PathDir[ldir * 2 + 1];
+			int cost = this->m_NodeCost[node] + (((n % 2) == 0) ? 14 : 10);
 
-			int dist = this->GetDist(endx, endy, dx, dy);
-
-			if (MinDist > dist)
+			if (cost >= this->m_NodeCost[next])
 			{
-				if (this->IsThisSpotOK(endx, endy) != FALSE && this->CanWeMoveForward3(endx, endy) != FALSE)
-				{
-					MinDist = dist;
-
-					WhichDir = ldir;
-				}
+				continue;
 			}
-		}
 
-		if (MinDist == 10000000)
-		{
-			for (i = dirstart + 2; i <= dirstart + 6; i++)
-			{
-				ldir = i % 8;
+			this->m_NodeCost[next] = cost;
 
-				int endx = sx + this->m_PathDir[ldir * 2];
+			this->m_NodeStep[next] = this->m_NodeStep[node] + 1;
 
-				int endy = sy + this->m_PathDir[ldir * 2 + 1];
+			this->m_NodeDir[next] = n;
 
-				int dist = this->GetDist(endx, endy, dx, dy);
+			int NextDist = this->GetDist(nx, ny, endx, endy);
 
-				if (MinDist > dist)
-				{
-					if (this->IsThisSpotOK(endx, endy) != FALSE && this->CanWeMoveForward3(endx, endy) != FALSE)
-					{
-						MinDist = dist;
-
-						WhichDir = ldir;
-					}
-				}
-			}
+			this->PushNode(next, ((cost + NextDist) * 4096) + NextDist);
 		}
 	}
 
-	if (MinDist == 10000000)
+	if (best == start)
 	{
-		return -1;
+		return false;
 	}
 
-	if (this->CanWeMoveForward3(sx + this->m_PathDir[WhichDir * 2], sy + this->m_PathDir[WhichDir * 2 + 1]) != FALSE)
-	{
-		int path = this->VerifyThatOnPath(sx, sy);
+	this->m_NumPath = this->m_NodeStep[best] + 1;
 
-		if (path != -1)
-		{
-			this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-			this->m_NumPath = path;
-		}
-
-		return WhichDir;
-	}
-
-	if (ErrorCheck != 0)
+	for (int n = this->m_NumPath - 1, node = best; n >= 0; n--)
 	{
-		int dir = WhichDir + 7;
-
-		dir %= 8;
-
-		if (this->CanWeMoveForward3(sx + this->m_PathDir[dir * 2], sy + this->m_PathDir[dir * 2 + 1]) != FALSE)
-		{
-			int path = this->VerifyThatOnPath(sx, sy);
-
-			if (path != -1)
-			{
-				this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-				this->m_NumPath = path;
-			}
-
-			return dir;
-		}
-
-		int dir2 = WhichDir + 9;
+		this->m_PathX[n] = OriginX + (node % MAX_PATH_RANGE);
 
-		dir2 %= 8;
+		this->m_PathY[n] = OriginY + (node / MAX_PATH_RANGE);
 
-		if (this->CanWeMoveForward3(sx + this->m_PathDir[dir2 * 2], sy + this->m_PathDir[dir2 * 2 + 1]) != FALSE)
+		if (n > 0)
 		{
-			int path = this->VerifyThatOnPath(sx, sy);
+			int dir = this->m_NodeDir[node];
 
-			if (path != -1)
-			{
-				this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-				this->m_NumPath = path;
-			}
-
-			return dir2;
+			node -= (this->m_PathDir[dir * 2 + 1] * MAX_PATH_RANGE) + this->m_PathDir[dir * 2];
 		}
 	}
 
-	this->m_HitAttr[sx + sy * this->m_width] = 1;
-
-	return -1;
+	return true;
 }
 
-bool CMapPath::FindPath(int startx, int starty, int endx, int endy, bool ErrorCheck)
+void CMapPath::NextGeneration()
 {
-	this->m_NumPath = 0;
-
-	int WhichDir = 0;
-
-	int NumFails = 0;
-
-	bool First;
+	this->m_HeapCount = 0;
 
-	memset(this->m_HitAttr, 0, this->m_width * this->m_height);
-
-	First = true;
-
-	while ((startx != endx) || (starty != endy))
+	if (++this->m_Generation == 0)
 	{
-		WhichDir = this->FindNextDir(startx, starty, endx, endy, WhichDir, First, ErrorCheck);
-
-		First = 0;
-
-		if (WhichDir >= 0)
-		{
-			this->m_PathX[this->m_NumPath] = startx;
-
-			this->m_PathY[this->m_NumPath] = starty;
-
-			startx += this->m_PathDir[WhichDir * 2];
-
-			starty += this->m_PathDir[WhichDir * 2 + 1];
-
-			this->m_NumPath++;
-
-			if (this->m_NumPath >= 15)
-			{
-				return false;
-			}
-		}
-		else if (ErrorCheck != false)
-		{
-			this->m_NumPath--;
-
-			if (this->m_NumPath < 0)
-			{
-				return false;
-			}
-
-			startx = this->m_PathX[this->m_NumPath];
-
-			starty = this->m_PathY[this->m_NumPath];
-
-			NumFails++;
-
-			if (NumFails >= 10)
-			{
-				return false;
-			}
-		}
-		else
-		{
-			break;
-		}
+		memset(this->m_NodeGeneration, 0, sizeof(this->m_NodeGeneration));
 
+		this->m_Generation = 1;
 	}
-
-	this->m_PathX[this->m_NumPath] = startx;
-
-	this->m_PathY[this->m_NumPath] = starty;
-
-	this->m_NumPath++;
-
-	if (this->m_NumPath >= 15)
-	{
-		return false;
-	}
-
-	return true;
 }
 
-bool CMapPath::FindPath2(int startx, int starty, int endx, int endy, bool ErrorCheck)
+void CMapPath::PushNode(int node, int key)
 {
-	this->m_NumPath = 0;
+	// Every node is expanded at most once and pushes at most eight
+	// neighbors, so the heap sized to that bound can never be full.
 
-	int WhichDir = 0;
+	int n = this->m_HeapCount++;
 
-	int NumFails = 0;
-
-	bool First;
-
-	memset(this->m_HitAttr, 0, this->m_width * this->m_height);
-
-	First = true;
-
-	while ((startx != endx) || (starty != endy))
+	while (n > 0)
 	{
-		WhichDir = this->FindNextDir2(startx, starty, endx, endy, WhichDir, First, ErrorCheck);
-
-		First = 0;
-
-		if (WhichDir >= 0)
-		{
-			this->m_PathX[this->m_NumPath] = startx;
-
-			this->m_PathY[this->m_NumPath] = starty;
-
-			startx += this->m_PathDir[WhichDir * 2];
-
-			starty += this->m_PathDir[WhichDir * 2 + 1];
+		int parent = (n - 1) / 2;
 
-			this->m_NumPath++;
-
-			if (this->m_NumPath >= 14)
-			{
-				this->m_NumPath--;
-
-				break;
-			}
-		}
-		else if (ErrorCheck != FALSE)
-		{
-			this->m_NumPath--;
-
-			if (this->m_NumPath < 0)
-			{
-				return false;
-			}
-
-			startx = this->m_PathX[this->m_NumPath];
-
-			starty = this->m_PathY[this->m_NumPath];
-
-			NumFails++;
-
-			if (NumFails >= 10)
-			{
-				return false;
-			}
-		}
-		else
+		if (this->m_Heap[parent].Key <= key)
 		{
 			break;
 		}
 
-	}
-
-	this->m_PathX[this->m_NumPath] = startx;
-
-	this->m_PathY[this->m_NumPath] = starty;
-
-	this->m_NumPath++;
+		this->m_Heap[n] = this->m_Heap[parent];
 
-	if (this->m_NumPath >= 15)
-	{
-		return false;
+		n = parent;
 	}
 
-	return true;
+	this->m_Heap[n].Key = key;
+
+	this->m_Heap[n].Node = node;
 }
 
-bool CMapPath::FindPath3(int startx, int starty, int endx, int endy, bool ErrorCheck)
+int CMapPath::PopNode()
 {
-	this->m_NumPath = 0;
-
-	int WhichDir = 0;
+	int node = this->m_Heap[0].Node;
 
-	int NumFails = 0;
+	PATH_HEAP_NODE last = this->m_Heap[--this->m_HeapCount];
 
-	bool First;
+	int n = 0;
 
-	memset(this->m_HitAttr, 0, this->m_width * this->m_height);
-
-	First = true;
-
-	while ((startx != endx) || (starty != endy))
+	while (true)
 	{
-		WhichDir = this->FindNextDir3(startx, starty, endx, endy, WhichDir, First, ErrorCheck);
-
-		First = 0;
+		int child = (n * 2) + 1;
 
-		if (WhichDir >= 0)
+		if (child >= this->m_HeapCount)
 		{
-			this->m_PathX[this->m_NumPath] = startx;
-
-			this->m_PathY[this->m_NumPath] = starty;
-
-			startx += this->m_PathDir[WhichDir * 2];
-
-			starty += this->m_PathDir[WhichDir * 2 + 1];
-
-			this->m_NumPath++;
-
-			if (this->m_NumPath >= 14)
-			{
-				this->m_NumPath--;
-
-				break;
-			}
+			break;
 		}
-		else if (ErrorCheck != FALSE)
-		{
-			this->m_NumPath--;
 
-			if (this->m_NumPath < 0)
-			{
-				return false;
-			}
-
-			startx = this->m_PathX[this->m_NumPath];
-
-			starty = this->m_PathY[this->m_NumPath];
-
-			NumFails++;
-
-			if (NumFails >= 10)
-			{
-				return false;
-			}
+		if ((child + 1) < this->m_HeapCount && this->m_Heap[child + 1].Key < this->m_Heap[child].Key)
+		{
+			child++;
 		}
-		else
+
+		if (last.Key <= this->m_Heap[child].Key)
 		{
 			break;
 		}
 
+		this->m_Heap[n] = this->m_Heap[child];
+
+		n = child;
 	}
 
-	this->m_PathX[this->m_NumPath] = startx;
+	this->m_Heap[n] = last;
 
-	this->m_PathY[this->m_NumPath] = starty;
+	return node;
+}
 
-	this->m_NumPath++;
+bool CMapPath::FindPath(int startx, int starty, int endx, int endy)
+{
+	return this->FindPathNode(startx, starty, endx, endy, MAP_ATTR_SAFTYZONE, 1);
+}
 
-	if (this->m_NumPath >= 15)
-	{
-		return false;
-	}
+bool CMapPath::FindPath2(int startx, int starty, int endx, int endy)
+{
+	return this->FindPathNode(startx, starty, endx, endy, MAP_ATTR_NONE, 0);
+}
 
-	return true;
+bool CMapPath::FindPath3(int startx, int starty, int endx, int endy)
+{
+	return this->FindPathNode(startx, starty, endx, endy, MAP_ATTR_NONE, 0);
 }
 
-void CMapPath::SetMapDimensions(int width, int height, BYTE* MapAttr)
+void CMapPath::SetMapDimensions(int width, int height, BYTE* MapAttr, BYTE* NeighborMask)
 {
 	this->m_width = width;
 
@@ -839,7 +325,7 @@ void CMapPath::SetMapDimensions(int width, int height, BYTE* MapAttr)
 
 	this->m_MapAttr = MapAttr;
 
-	this->m_HitAttr = new BYTE[this->m_width * this->m_height];
+	this->m_NeighborMask = NeighborMask;
 }
 
 int CMapPath::GetPath()
@@ -1,5 +1,10 @@
 #pragma once
 
+#define MAX_PATH_STEP 13
+#define MAX_PATH_RANGE ((MAX_PATH_STEP * 2) + 1)
+#define MAX_PATH_NODE (MAX_PATH_RANGE * MAX_PATH_RANGE)
+#define MAX_PATH_HEAP ((MAX_PATH_NODE * 8) + 1)
+
 struct PATH_INFO
 {
 	int PathNum;
@@ -8,6 +13,12 @@ struct PATH_INFO
 	int CurrentPath;
 };
 
+struct PATH_HEAP_NODE
+{
+	int Key;
+	short Node;
+};
+
 class CMapPath
 {
 public:
@@ -16,13 +27,13 @@ public:
 
 	~CMapPath();
 
-	bool FindPath(int startx, int starty, int endx, int endy, bool ErrorCheck);
+	bool FindPath(int startx, int starty, int endx, int endy);
 
-	bool FindPath2(int startx, int starty, int endx, int endy, bool ErrorCheck);
+	bool FindPath2(int startx, int starty, int endx, int endy);
 
-	bool FindPath3(int startx, int starty, int endx, int endy, bool ErrorCheck);
+	bool FindPath3(int startx, int starty, int endx, int endy);
 
-	void SetMapDimensions(int width, int height, BYTE* MapAttr);
+	void SetMapDimensions(int width, int height, BYTE* MapAttr, BYTE* NeighborMask);
 
 	int GetPath();
 
@@ -34,21 +45,13 @@ private:
 
 	int GetDist(int x1, int y1, int x2, int y2);
 
-	int VerifyThatOnPath(int x, int y);
-
-	BOOL CanWeMoveForward(int x, int y);
-
-	BOOL CanWeMoveForward2(int x, int y);
-
-	BOOL CanWeMoveForward3(int x, int y);
+	bool FindPathNode(int startx, int starty, int endx, int endy, BYTE MaxAttr, bool strict);
 
-	BOOL IsThisSpotOK(int x, int y);
+	void NextGeneration();
 
-	int FindNextDir(int sx, int sy, int dx, int dy, int dirstart, bool First, bool ErrorCheck);
+	void PushNode(int node, int key);
 
-	int FindNextDir2(int sx, int sy, int dx, int dy, int dirstart, bool First, bool ErrorCheck);
-
-	int FindNextDir3(int sx, int sy, int dx, int dy, int dirstart, bool First, bool ErrorCheck);
+	int PopNode();
 
 private:
 
@@ -58,25 +61,29 @@ private:
 
 	int m_NumPath;
 
-	BYTE m_PathX[500];
+	BYTE m_PathX[MAX_PATH_STEP + 1];
 
-	BYTE m_PathY[500];
+	BYTE m_PathY[MAX_PATH_STEP + 1];
 
 	int m_PathDir[16];
 
-	int m_LastDir;
+	BYTE* m_MapAttr;
 
-	int m_NumFails;
+	BYTE* m_NeighborMask;
 
-	BYTE* m_MapAttr;
+	WORD m_Generation;
 
-	BYTE* m_HitAttr;
+	WORD m_NodeGeneration[MAX_PATH_NODE];
 
-	int m_stx;
+	WORD m_NodeCost[MAX_PATH_NODE];
 
-	int m_sty;
+	BYTE m_NodeStep[MAX_PATH_NODE];
 
-	int m_edx;
+	BYTE m_NodeDir[MAX_PATH_NODE];
 
-	int m_edy;
-};
\ No newline at end of file
+	BYTE m_NodeClosed[MAX_PATH_NODE];
+
+	PATH_HEAP_NODE m_Heap[MAX_PATH_HEAP];
+
+	int m_HeapCount;
+};
@@ -1,11 +1,16 @@
 #include "stdafx.h"
 #include "MemoryAllocator.h"
+#include "SocketManager.h"
 
 CMemoryAllocator gMemoryAllocator;
 
 CMemoryAllocator::CMemoryAllocator()
 {
 	this->m_TempMemoryAllocatorInfo.m_Index = OBJECT_START_USER;
+
+	this->m_ObjectArena = (MEMORY_ALLOCATOR_OBJECT*)(new BYTE[sizeof(MEMORY_ALLOCATOR_OBJECT) * (MAX_OBJECT + 1)]);
+
+	this->m_UserArena = (MEMORY_ALLOCATOR_USER*)(new BYTE[sizeof(MEMORY_ALLOCATOR_USER) * (MAX_OBJECT_USER + 1)]);
 }
 
 CMemoryAllocator::~CMemoryAllocator()
@@ -17,21 +22,27 @@ bool CMemoryAllocator::GetMemoryAllocatorFree(int* index, int MinIndex, int MaxI
 {
 	this->m_critical.lock();
 
-	DWORD CurActiveTime = 0;
+	std::deque<MEMORY_ALLOCATOR_FREE>* lpQueue = &this->m_FreeQueue[this->GetMemoryAllocatorRange(MinIndex)];
 
-	DWORD MaxActiveTime = 0;
-
-	for (int n = MinIndex; n < MaxIndex; n++)
+	while (lpQueue->empty() == 0)
 	{
-		if (OBJECT_RANGE(this->m_MemoryAllocatorInfo[n].m_Index) != 0)
+		MEMORY_ALLOCATOR_FREE* lpFree = &lpQueue->front();
+
+		CMemoryAllocatorInfo* lpInfo = &this->m_MemoryAllocatorInfo[lpFree->Index];
+
+		if (lpFree->Index < MinIndex || lpFree->Index >= MaxIndex || lpInfo->m_Index != lpFree->Index || lpInfo->m_Active != 0 || lpInfo->m_ActiveTime != lpFree->ActiveTime)
 		{
-			if (this->m_MemoryAllocatorInfo[n].m_Active == 0 && (CurActiveTime = (GetTickCount() - this->m_MemoryAllocatorInfo[n].m_ActiveTime)) > MinTime && CurActiveTime > MaxActiveTime)
-			{
-				(*index) = this->m_MemoryAllocatorInfo[n].m_Index;
+			lpQueue->pop_front();
 
-				MaxActiveTime = CurActiveTime;
-			}
+			continue;
 		}
+
+		if ((GetTickCount() - lpInfo->m_ActiveTime) >= MinTime)
+		{
+			(*index) = lpFree->Index;
+		}
+
+		break;
 	}
 
 	this->m_critical.unlock();
@@ -77,6 +88,17 @@ void CMemoryAllocator::InsertMemoryAllocatorInfo(CMemoryAllocatorInfo MemoryAllo
 
 	this->m_MemoryAllocatorInfo[MemoryAllocatorInfo.m_Index] = MemoryAllocatorInfo;
 
+	if (MemoryAllocatorInfo.m_Active == 0)
+	{
+		MEMORY_ALLOCATOR_FREE info;
+
+		info.Index = MemoryAllocatorInfo.m_Index;
+
+		info.ActiveTime = MemoryAllocatorInfo.m_ActiveTime;
+
+		this->m_FreeQueue[this->GetMemoryAllocatorRange(info.Index)].push_back(info);
+	}
+
 	this->m_critical.unlock();
 }
 
@@ -115,14 +137,18 @@ void CMemoryAllocator::BindMemoryAllocatorInfo(int index, CMemoryAllocatorInfo M
 
 	lpObj->VpPlayerItem = MemoryAllocatorInfo.m_VpPlayerItem;
 
+	lpObj->VpIndex = MemoryAllocatorInfo.m_VpIndex;
+
+	lpObj->VpIndex2 = MemoryAllocatorInfo.m_VpIndex2;
+
+	lpObj->VpIndexItem = MemoryAllocatorInfo.m_VpIndexItem;
+
 	lpObj->HitDamage = MemoryAllocatorInfo.m_HitDamage;
 
 	lpObj->Effect = MemoryAllocatorInfo.m_Effect;
 
 	if (OBJECT_USER_RANGE(index) != 0)
 	{
-		lpObj->PerSocketContext = MemoryAllocatorInfo.m_PerSocketContext;
-
 		lpObj->Inventory1 = MemoryAllocatorInfo.m_Inventory1;
 
 		lpObj->Inventory2 = MemoryAllocatorInfo.m_Inventory2;
@@ -148,6 +174,8 @@ void CMemoryAllocator::BindMemoryAllocatorInfo(int index, CMemoryAllocatorInfo M
 		lpObj->HackPacketDelay = MemoryAllocatorInfo.m_HackPacketDelay;
 
 		lpObj->HackPacketCount = MemoryAllocatorInfo.m_HackPacketCount;
+
+		lpObj->UserData = MemoryAllocatorInfo.m_UserData;
 	}
 	else
 	{
@@ -158,5 +186,134 @@ void CMemoryAllocator::BindMemoryAllocatorInfo(int index, CMemoryAllocatorInfo M
 		lpObj->InventoryMap1 = ((MemoryAllocatorInfo.m_InventoryMap1 == 0) ? this->m_TempMemoryAllocatorInfo.m_InventoryMap1 : MemoryAllocatorInfo.m_InventoryMap1);
 
 		lpObj->InventoryMap2 = ((MemoryAllocatorInfo.m_InventoryMap2 == 0) ? this->m_TempMemoryAllocatorInfo.m_InventoryMap2 : MemoryAllocatorInfo.m_InventoryMap2);
+
+		lpObj->UserData = ((MemoryAllocatorInfo.m_UserData == 0) ? this->m_TempMemoryAllocatorInfo.m_UserData : MemoryAllocatorInfo.m_UserData);
+	}
+}
+
+int CMemoryAllocator::GetMemoryAllocatorRange(int index)
+{
+	if (OBJECT_MONSTER_RANGE(index) != 0)
+	{
+		return 0;
+	}
+
+	if (OBJECT_SUMMON_RANGE(index) != 0)
+	{
+		return 1;
+	}
+
+	return 2;
+}
+
+MEMORY_ALLOCATOR_OBJECT* CMemoryAllocator::GetObjectArena(int index)
+{
+	if (index < 0 || index > MEMORY_ALLOCATOR_TEMP_INDEX)
+	{
+		return 0;
+	}
+
+	return &this->m_ObjectArena[index];
+}
+
+MEMORY_ALLOCATOR_USER* CMemoryAllocator::GetUserArena(int index)
+{
+	if (index < OBJECT_START_USER || index > MEMORY_ALLOCATOR_TEMP_INDEX)
+	{
+		return 0;
+	}
+
+	return &this->m_UserArena[index - OBJECT_START_USER];
+}
+PER_SOCKET_CONTEXT* CMemoryAllocator::AllocSocketContext()
+{
+	this->m_critical.lock();
+
+	if (this->m_SocketContextQueue.empty() != 0)
+	{
+		PER_SOCKET_CONTEXT* lpSlab = new PER_SOCKET_CONTEXT[MEMORY_ALLOCATOR_SOCKET_SLAB];
+
+		for (int n = 0; n < MEMORY_ALLOCATOR_SOCKET_SLAB; n++)
+		{
+			lpSlab[n].IoSendContext.IoSideBuffer.buff = 0;
+
+			lpSlab[n].IoSendContext.IoSideBuffer.size = 0;
+
+			lpSlab[n].IoSendContext.IoSideBuffer.capacity = 0;
+
+			this->m_SocketContextQueue.push_back(&lpSlab[n]);
+		}
+	}
+
+	PER_SOCKET_CONTEXT* lpPerSocketContext = this->m_SocketContextQueue.front();
+
+	this->m_SocketContextQueue.pop_front();
+
+	this->m_critical.unlock();
+
+	return lpPerSocketContext;
+}
+
+void CMemoryAllocator::FreeSocketContext(PER_SOCKET_CONTEXT* lpPerSocketContext)
+{
+	if (lpPerSocketContext == 0)
+	{
+		return;
+	}
+
+	this->m_critical.lock();
+
+	if (lpPerSocketContext->IoSendContext.IoSideBuffer.capacity > MIN_SIDE_PACKET_SIZE)
+	{
+		delete[] lpPerSocketContext->IoSendContext.IoSideBuffer.buff;
+
+		lpPerSocketContext->IoSendContext.IoSideBuffer.buff = 0;
+
+		lpPerSocketContext->IoSendContext.IoSideBuffer.capacity = 0;
+	}
+
+	lpPerSocketContext->IoSendContext.IoSideBuffer.size = 0;
+
+	this->m_SocketContextQueue.push_back(lpPerSocketContext);
+
+	this->m_critical.unlock();
+}
+
+bool CMemoryAllocator::GrowSocketContext(PER_SOCKET_CONTEXT* lpPerSocketContext, int size)
+{
+	IO_SIDE_BUFFER* lpBuffer = &lpPerSocketContext->IoSendContext.IoSideBuffer;
+
+	if (size <= lpBuffer->capacity)
+	{
+		return 1;
+	}
+
+	if (size > MAX_SIDE_PACKET_SIZE)
+	{
+		return 0;
+	}
+
+	int capacity = ((lpBuffer->capacity == 0) ? MIN_SIDE_PACKET_SIZE : lpBuffer->capacity);
+
+	while (capacity < size)
+	{
+		capacity *= 2;
+	}
+
+	capacity = ((capacity > MAX_SIDE_PACKET_SIZE) ? MAX_SIDE_PACKET_SIZE : capacity);
+
+	BYTE* buff = new BYTE[capacity];
+
+	if (lpBuffer->size > 0)
+	{
+		memcpy(buff, lpBuffer->buff, lpBuffer->size);
 	}
-}
\ No newline at end of file
+
+	delete[] lpBuffer->buff;
+
+	lpBuffer->buff = buff;
+
+	lpBuffer->capacity = capacity;
+
+	return 1;
+}
@@ -3,6 +3,16 @@
 #include "CriticalSection.h"
 #include "MemoryAllocatorInfo.h"
 
+#define MAX_MEMORY_ALLOCATOR_RANGE 3
+#define MEMORY_ALLOCATOR_TEMP_INDEX MAX_OBJECT
+#define MEMORY_ALLOCATOR_SOCKET_SLAB 32
+
+struct MEMORY_ALLOCATOR_FREE
+{
+	int Index;
+	DWORD ActiveTime;
+};
+
 class CMemoryAllocator
 {
 public:
@@ -21,6 +31,18 @@ public:
 
 	void BindMemoryAllocatorInfo(int index, CMemoryAllocatorInfo MemoryAllocatorInfo);
 
+	int GetMemoryAllocatorRange(int index);
+
+	MEMORY_ALLOCATOR_OBJECT* GetObjectArena(int index);
+
+	MEMORY_ALLOCATOR_USER* GetUserArena(int index);
+
+	PER_SOCKET_CONTEXT* AllocSocketContext();
+
+	void FreeSocketContext(PER_SOCKET_CONTEXT* lpPerSocketContext);
+
+	bool GrowSocketContext(PER_SOCKET_CONTEXT* lpPerSocketContext, int size);
+
 public:
 
 	CCriticalSection m_critical;
@@ -28,6 +50,14 @@ public:
 	CMemoryAllocatorInfo m_TempMemoryAllocatorInfo;
 
 	CMemoryAllocatorInfo m_MemoryAllocatorInfo[MAX_OBJECT];
+
+	std::deque<MEMORY_ALLOCATOR_FREE> m_FreeQueue[MAX_MEMORY_ALLOCATOR_RANGE];
+
+	MEMORY_ALLOCATOR_OBJECT* m_ObjectArena;
+
+	MEMORY_ALLOCATOR_USER* m_UserArena;
+
+	std::deque<PER_SOCKET_CONTEXT*> m_SocketContextQueue;
 };
 
 extern CMemoryAllocator gMemoryAllocator;
\ No newline at end of file
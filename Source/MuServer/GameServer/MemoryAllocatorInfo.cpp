@@ -4,7 +4,6 @@
 #include "HackPacketCheck.h"
 #include "Quest.h"
 #include "SkillManager.h"
-#include "SocketManager.h"
 
 CMemoryAllocatorInfo::CMemoryAllocatorInfo()
 {
@@ -29,6 +28,12 @@ void CMemoryAllocatorInfo::Clear()
 
 	this->m_VpPlayerItem = 0;
 
+	this->m_VpIndex = 0;
+
+	this->m_VpIndex2 = 0;
+
+	this->m_VpIndexItem = 0;
+
 	this->m_HitDamage = 0;
 
 	this->m_Effect = 0;
@@ -58,52 +63,70 @@ void CMemoryAllocatorInfo::Clear()
 	this->m_HackPacketDelay = 0;
 
 	this->m_HackPacketCount = 0;
+
+	this->m_UserData = 0;
 }
 
-void CMemoryAllocatorInfo::Alloc()
+void CMemoryAllocatorInfo::Alloc(MEMORY_ALLOCATOR_OBJECT* lpObject, MEMORY_ALLOCATOR_USER* lpUser)
 {
-	this->m_SkillBackup = new CSkill[MAX_SKILL_LIST];
+	new(lpObject) MEMORY_ALLOCATOR_OBJECT;
+
+	this->m_SkillBackup = lpObject->SkillBackup;
+
+	this->m_Skill = lpObject->Skill;
 
-	this->m_Skill = new CSkill[MAX_SKILL_LIST];
+	this->m_VpPlayer = lpObject->VpPlayer;
 
-	this->m_VpPlayer = new VIEWPORT_STRUCT[MAX_VIEWPORT];
+	this->m_VpPlayer2 = lpObject->VpPlayer2;
 
-	this->m_VpPlayer2 = new VIEWPORT_STRUCT[MAX_VIEWPORT];
+	this->m_VpPlayerItem = lpObject->VpPlayerItem;
 
-	this->m_VpPlayerItem = new VIEWPORT_STRUCT[MAX_VIEWPORT];
+	this->m_VpIndex = &lpObject->VpIndex;
 
-	this->m_HitDamage = new HIT_DAMAGE_STRUCT[MAX_HIT_DAMAGE];
+	this->m_VpIndex2 = &lpObject->VpIndex2;
 
-	this->m_Effect = new CEffect[MAX_EFFECT_LIST];
+	this->m_VpIndexItem = &lpObject->VpIndexItem;
 
-	if (OBJECT_USER_RANGE(this->m_Index) != 0)
+	this->m_VpIndex->Clear();
+
+	this->m_VpIndex2->Clear();
+
+	this->m_VpIndexItem->Clear();
+
+	this->m_HitDamage = lpObject->HitDamage;
+
+	this->m_Effect = lpObject->Effect;
+
+	if (lpUser != 0)
 	{
-		this->m_PerSocketContext = new PER_SOCKET_CONTEXT;
+		new(lpUser) MEMORY_ALLOCATOR_USER();
+
+		this->m_Inventory1 = lpUser->Inventory1;
 
-		this->m_Inventory1 = new CItem[INVENTORY_SIZE];
+		this->m_Inventory2 = lpUser->Inventory2;
 
-		this->m_Inventory2 = new CItem[INVENTORY_SIZE];
+		this->m_InventoryMap1 = lpUser->InventoryMap1;
 
-		this->m_InventoryMap1 = new BYTE[INVENTORY_SIZE];
+		this->m_InventoryMap2 = lpUser->InventoryMap2;
 
-		this->m_InventoryMap2 = new BYTE[INVENTORY_SIZE];
+		this->m_Trade = lpUser->Trade;
 
-		this->m_Trade = new CItem[TRADE_SIZE];
+		this->m_TradeMap = lpUser->TradeMap;
 
-		this->m_TradeMap = new BYTE[TRADE_SIZE];
+		this->m_Warehouse = lpUser->Warehouse;
 
-		this->m_Warehouse = new CItem[WAREHOUSE_SIZE];
+		this->m_WarehouseMap = lpUser->WarehouseMap;
 
-		this->m_WarehouseMap = new BYTE[WAREHOUSE_SIZE];
+		this->m_ChaosBox = lpUser->ChaosBox;
 
-		this->m_ChaosBox = new CItem[CHAOS_BOX_SIZE];
+		this->m_ChaosBoxMap = lpUser->ChaosBoxMap;
 
-		this->m_ChaosBoxMap = new BYTE[CHAOS_BOX_SIZE];
+		this->m_SkillDelay = lpUser->SkillDelay;
 
-		this->m_SkillDelay = new DWORD[MAX_SKILL];
+		this->m_HackPacketDelay = lpUser->HackPacketDelay;
 
-		this->m_HackPacketDelay = new DWORD[MAX_HACK_PACKET_INFO];
+		this->m_HackPacketCount = lpUser->HackPacketCount;
 
-		this->m_HackPacketCount = new DWORD[MAX_HACK_PACKET_INFO];
+		this->m_UserData = &lpUser->UserData;
 	}
 }
\ No newline at end of file
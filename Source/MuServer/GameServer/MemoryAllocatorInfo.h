@@ -1,6 +1,43 @@
 #pragma once
 
+#include "EffectManager.h"
+#include "HackPacketCheck.h"
+#include "SkillManager.h"
 #include "User.h"
+#include "Viewport.h"
+
+struct MEMORY_ALLOCATOR_OBJECT
+{
+	OBJECTSTRUCT Object;
+	CSkill SkillBackup[MAX_SKILL_LIST];
+	CSkill Skill[MAX_SKILL_LIST];
+	VIEWPORT_STRUCT VpPlayer[MAX_VIEWPORT];
+	VIEWPORT_STRUCT VpPlayer2[MAX_VIEWPORT];
+	VIEWPORT_STRUCT VpPlayerItem[MAX_VIEWPORT];
+	VIEWPORT_INDEX VpIndex;
+	VIEWPORT_INDEX VpIndex2;
+	VIEWPORT_INDEX VpIndexItem;
+	HIT_DAMAGE_STRUCT HitDamage[MAX_HIT_DAMAGE];
+	CEffect Effect[MAX_EFFECT_LIST];
+};
+
+struct MEMORY_ALLOCATOR_USER
+{
+	CItem Inventory1[INVENTORY_SIZE];
+	CItem Inventory2[INVENTORY_SIZE];
+	BYTE InventoryMap1[INVENTORY_SIZE];
+	BYTE InventoryMap2[INVENTORY_SIZE];
+	CItem Trade[TRADE_SIZE];
+	BYTE TradeMap[TRADE_SIZE];
+	CItem Warehouse[WAREHOUSE_SIZE];
+	BYTE WarehouseMap[WAREHOUSE_SIZE];
+	CItem ChaosBox[CHAOS_BOX_SIZE];
+	BYTE ChaosBoxMap[CHAOS_BOX_SIZE];
+	DWORD SkillDelay[MAX_SKILL];
+	DWORD HackPacketDelay[MAX_HACK_PACKET_INFO];
+	DWORD HackPacketCount[MAX_HACK_PACKET_INFO];
+	OBJECT_USER_DATA UserData;
+};
 
 class CMemoryAllocatorInfo
 {
@@ -10,7 +47,7 @@ public:
 
 	void Clear();
 
-	void Alloc();
+	void Alloc(MEMORY_ALLOCATOR_OBJECT* lpObject, MEMORY_ALLOCATOR_USER* lpUser);
 
 public:
 
@@ -30,12 +67,16 @@ public:
 
 	VIEWPORT_STRUCT* m_VpPlayerItem;
 
+	VIEWPORT_INDEX* m_VpIndex;
+
+	VIEWPORT_INDEX* m_VpIndex2;
+
+	VIEWPORT_INDEX* m_VpIndexItem;
+
 	HIT_DAMAGE_STRUCT* m_HitDamage;
 
 	CEffect* m_Effect;
 
-	PER_SOCKET_CONTEXT* m_PerSocketContext;
-
 	CItem* m_Inventory1;
 
 	CItem* m_Inventory2;
@@ -61,4 +102,6 @@ public:
 	DWORD* m_HackPacketDelay;
 
 	DWORD* m_HackPacketCount;
+
+	OBJECT_USER_DATA* m_UserData;
 };
\ No newline at end of file
@@ -348,6 +348,8 @@ bool gObjBallRegen(LPOBJ lpObj)
 
 			lpObj->RegenTime = GetTickCount();
 
+			gObjectManager.ObjectRegenSchedule(lpObj);
+
 			return 0;
 		}
 
@@ -367,6 +369,8 @@ bool gObjBallRegen(LPOBJ lpObj)
 
 			lpObj->RegenTime = GetTickCount();
 
+			gObjectManager.ObjectRegenSchedule(lpObj);
+
 			return 0;
 		}
 	}
@@ -436,6 +440,8 @@ bool gObjMonsterRegen(LPOBJ lpObj)
 
 			lpObj->RegenTime = GetTickCount();
 
+			gObjectManager.ObjectRegenSchedule(lpObj);
+
 			return 0;
 		}
 
@@ -455,6 +461,8 @@ bool gObjMonsterRegen(LPOBJ lpObj)
 
 			lpObj->RegenTime = GetTickCount();
 
+			gObjectManager.ObjectRegenSchedule(lpObj);
+
 			return 0;
 		}
 	}
@@ -715,61 +723,28 @@ int gObjAddMonster(int map)
 
 	critical.lock();
 
-	int index = -1;
+	int index = gObjGetFreeIndex(OBJECT_START_MONSTER, MAX_OBJECT_MONSTER);
 
-	int count = gObjMonCount;
-
-	if (gMemoryAllocator.GetMemoryAllocatorFree(&index, OBJECT_START_MONSTER, MAX_OBJECT_MONSTER, 10000) != 0)
+	if (index == -1 || gObjAllocData(index) == 0)
 	{
-		gObjAllocData(index);
-
-		gObjCharZeroSet(index);
-
-		gObj[index].Index = index;
-
-		gObj[index].Connected = OBJECT_CONNECTED;
-
-		gObjTotalMonster++;
-
-		gServerDisplayer.SetWindowName();
-
 		critical.unlock();
 
-		return index;
+		return -1;
 	}
 
-	for (int n = OBJECT_START_MONSTER; n < MAX_OBJECT_MONSTER; n++)
-	{
-		if (gObj[count].Connected == OBJECT_OFFLINE)
-		{
-			if (gObjAllocData(count) == 0)
-			{
-				break;
-			}
+	gObjCharZeroSet(index);
 
-			gObjCharZeroSet(count);
+	gObj[index].Index = index;
 
-			gObj[count].Index = count;
+	gObj[index].Connected = OBJECT_CONNECTED;
 
-			gObj[count].Connected = OBJECT_CONNECTED;
+	gObjTotalMonster++;
 
-			gObjTotalMonster++;
-
-			gServerDisplayer.SetWindowName();
-
-			critical.unlock();
-
-			return count;
-		}
-		else
-		{
-			count = (((++count) >= MAX_OBJECT_MONSTER) ? OBJECT_START_MONSTER : count);
-		}
-	}
+	gServerDisplayer.SetWindowName();
 
 	critical.unlock();
 
-	return -1;
+	return index;
 }
 
 int gObjAddSummon()
@@ -778,61 +753,28 @@ int gObjAddSummon()
 
 	critical.lock();
 
-	int index = -1;
-
-	int count = gObjCallMonCount;
+	int index = gObjGetFreeIndex(MAX_OBJECT_MONSTER, OBJECT_START_USER);
 
-	if (gMemoryAllocator.GetMemoryAllocatorFree(&index, MAX_OBJECT_MONSTER, OBJECT_START_USER, 10000) != 0)
+	if (index == -1 || gObjAllocData(index) == 0)
 	{
-		gObjAllocData(index);
-
-		gObjCharZeroSet(index);
-
-		gObj[index].Index = index;
-
-		gObj[index].Connected = OBJECT_CONNECTED;
-
-		gObjTotalMonster++;
-
-		gServerDisplayer.SetWindowName();
-
 		critical.unlock();
 
-		return index;
+		return -1;
 	}
 
-	for (int n = MAX_OBJECT_MONSTER; n < OBJECT_START_USER; n++)
-	{
-		if (gObj[count].Connected == OBJECT_OFFLINE)
-		{
-			if (gObjAllocData(count) == 0)
-			{
-				break;
-			}
-
-			gObjCharZeroSet(count);
-
-			gObj[count].Index = count;
+	gObjCharZeroSet(index);
 
-			gObj[count].Connected = OBJECT_CONNECTED;
+	gObj[index].Index = index;
 
-			gObjTotalMonster++;
+	gObj[index].Connected = OBJECT_CONNECTED;
 
-			gServerDisplayer.SetWindowName();
+	gObjTotalMonster++;
 
-			critical.unlock();
-
-			return count;
-		}
-		else
-		{
-			count = (((++count) >= OBJECT_START_USER) ? MAX_OBJECT_MONSTER : count);
-		}
-	}
+	gServerDisplayer.SetWindowName();
 
 	critical.unlock();
 
-	return -1;
+	return index;
 }
 
 int gObjSummonSetEnemy(LPOBJ lpObj, int aIndex)
@@ -920,21 +862,23 @@ void gObjMonsterMagicAttack(LPOBJ lpObj, int skill)
 
 	PMSG_MULTI_SKILL_ATTACK info;
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
+	for (int n = 0; n < lpObj->VpIndex2->ListCount; n++)
 	{
-		if (lpObj->VpPlayer2[n].state == VIEWPORT_NONE || OBJECT_RANGE(lpObj->VpPlayer2[n].index) == false || lpObj->VpPlayer2[n].type != OBJECT_USER)
+		VIEWPORT_STRUCT* lpViewport = &lpObj->VpPlayer2[lpObj->VpIndex2->List[n]];
+
+		if (lpViewport->state == VIEWPORT_NONE || OBJECT_RANGE(lpViewport->index) == false || lpViewport->type != OBJECT_USER)
 		{
 			continue;
 		}
 
-		if (gObjCalcDistance(lpObj, &gObj[lpObj->VpPlayer2[n].index]) >= 6)
+		if (gObjCalcDistance(lpObj, &gObj[lpViewport->index]) >= 6)
 		{
 			continue;
 		}
 
-		info.index[0] = SET_NUMBERHB(lpObj->VpPlayer2[n].index);
+		info.index[0] = SET_NUMBERHB(lpViewport->index);
 
-		info.index[1] = SET_NUMBERLB(lpObj->VpPlayer2[n].index);
+		info.index[1] = SET_NUMBERLB(lpViewport->index);
 
 		memcpy(&send[size], &info, sizeof(info));
 
@@ -1370,9 +1314,9 @@ int gObjMonsterSearchEnemy(LPOBJ lpObj, BYTE objtype)
 	t1 = objtype;//&OBJTYPE_CHARACTER;
 	t2 = objtype;//&OBJTYPE_MONSTER;
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
+	for (int n = 0; n < lpObj->VpIndex2->ListCount; n++)
 	{
-		tObjNum = lpObj->VpPlayer2[n].index;
+		tObjNum = lpObj->VpPlayer2[lpObj->VpIndex2->List[n]].index;
 
 		if (tObjNum >= 0)
 		{
@@ -1410,9 +1354,9 @@ int gObjGuardSearchEnemy(LPOBJ lpObj)
 	int tObjNum;
 	BYTE attr;
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
+	for (int n = 0; n < lpObj->VpIndex2->ListCount; n++)
 	{
-		tObjNum = lpObj->VpPlayer2[n].index;
+		tObjNum = lpObj->VpPlayer2[lpObj->VpIndex2->List[n]].index;
 
 		if (tObjNum >= 0)
 		{
@@ -1454,8 +1398,6 @@ int gObjGuardSearchEnemy(LPOBJ lpObj)
 
 void gObjMonsterProcess(LPOBJ lpObj)
 {
-	gObjectManager.ObjectMsgProc(lpObj);
-
 	if (lpObj->Live == FALSE)
 	{
 		return;
@@ -1673,7 +1615,24 @@ BOOL PathFindMoveMsgSend(LPOBJ lpObj)
 
 	PATH_INFO path;
 
-	BOOL bPathFound = gMap[lpObj->Map].PathFinding2(lpObj->X, lpObj->Y, lpObj->MTX, lpObj->MTY, &path);
+	BOOL bPathFound = FALSE;
+
+	if (gServerInfo.m_MonsterFlowFieldSwitch != 0 && gMap[lpObj->Map].m_EventMap != 0 && OBJECT_RANGE(lpObj->TargetNumber) != 0)
+	{
+		LPOBJ lpTarget = &gObj[lpObj->TargetNumber];
+
+		if (lpTarget->Map == lpObj->Map)
+		{
+			int range = ((abs(lpObj->MTX - lpTarget->X) > abs(lpObj->MTY - lpTarget->Y)) ? abs(lpObj->MTX - lpTarget->X) : abs(lpObj->MTY - lpTarget->Y));
+
+			bPathFound = gMap[lpObj->Map].PathFindingFlow(lpObj->X, lpObj->Y, lpTarget->Index, lpTarget->X, lpTarget->Y, lpObj->MTX, lpObj->MTY, range, &path);
+		}
+	}
+
+	if (bPathFound == FALSE)
+	{
+		bPathFound = gMap[lpObj->Map].PathFinding2(lpObj->X, lpObj->Y, lpObj->MTX, lpObj->MTY, &path);
+	}
 
 	if (bPathFound)
 	{
@@ -2083,9 +2042,9 @@ void gObjTrapAttackEnemySearchX(LPOBJ lpObj, int count)
 	{
 		x++;
 
-		for (int i = 0; i < MAX_VIEWPORT; i++)
+		for (int i = 0; i < lpObj->VpIndex2->ListCount; i++)
 		{
-			tObjNum = lpObj->VpPlayer2[i].index;
+			tObjNum = lpObj->VpPlayer2[lpObj->VpIndex2->List[i]].index;
 
 			if (tObjNum >= 0)
 			{
@@ -2123,9 +2082,9 @@ void gObjTrapAttackEnemySearchY(LPOBJ lpObj, int count)
 	{
 		y--;
 
-		for (int i = 0; i < MAX_VIEWPORT; i++)
+		for (int i = 0; i < lpObj->VpIndex2->ListCount; i++)
 		{
-			tObjNum = lpObj->VpPlayer2[i].index;
+			tObjNum = lpObj->VpPlayer2[lpObj->VpIndex2->List[i]].index;
 
 			if (tObjNum >= 0)
 			{
@@ -2158,9 +2117,9 @@ void gObjTrapAttackEnemySearch(LPOBJ lpObj)
 
 	lpObj->TargetNumber = -1;
 
-	for (int i = 0; i < MAX_VIEWPORT; i++)
+	for (int i = 0; i < lpObj->VpIndex2->ListCount; i++)
 	{
-		tObjNum = lpObj->VpPlayer2[i].index;
+		tObjNum = lpObj->VpPlayer2[lpObj->VpIndex2->List[i]].index;
 
 		if (tObjNum >= 0)
 		{
@@ -2201,9 +2160,9 @@ void gObjTrapAttackEnemySearchRange(LPOBJ lpObj, int iRange)
 
 	iTargetingRate = 100 / lpObj->VPCount;
 
-	for (int i = 0; i < MAX_VIEWPORT; i++)
+	for (int i = 0; i < lpObj->VpIndex2->ListCount; i++)
 	{
-		tObjNum = lpObj->VpPlayer2[i].index;
+		tObjNum = lpObj->VpPlayer2[lpObj->VpIndex2->List[i]].index;
 
 		if (tObjNum >= 0)
 		{
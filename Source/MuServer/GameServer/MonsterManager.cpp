@@ -188,19 +188,19 @@ void CMonsterManager::InsertMonsterItem(int level)
 {
 	for (int n = 0; n < MAX_ITEM; n++)
 	{
-		ITEM_INFO ItemInfo;
+		ITEM_INFO* lpItemInfo = gItemManager.GetInfo(n);
 
-		if (gItemManager.GetInfo(n, &ItemInfo) == 0)
+		if (lpItemInfo == 0)
 		{
 			continue;
 		}
 
-		if (ItemInfo.Level < 0 || ItemInfo.DropItem == 0)
+		if (lpItemInfo->Level < 0 || lpItemInfo->DropItem == 0)
 		{
 			continue;
 		}
 
-		if ((ItemInfo.Level + 4) >= level && (ItemInfo.Level - 2) <= level)
+		if ((lpItemInfo->Level + 4) >= level && (lpItemInfo->Level - 2) <= level)
 		{
 			MONSTER_ITEM_INFO* lpItem = &this->m_MonsterItemInfo[level];
 
@@ -179,7 +179,7 @@ bool CMonsterSetBase::GetBoxPosition(int map, int x, int y, int tx, int ty, shor
 
 		suby = y + (GetLargeRand() % suby);
 
-		if (gMap[map].CheckAttr(subx, suby, 1) == 0 && gMap[map].CheckAttr(subx, suby, 4) == 0 && gMap[map].CheckAttr(subx, suby, 8) == 0)
+		if (gMap[map].CheckSafeAttr(subx, suby) == 0 && gMap[map].CheckWalkAttr(subx, suby) != 0)
 		{
 			(*ox) = subx;
 
@@ -15,7 +15,10 @@ CMove gMove;
 
 CMove::CMove()
 {
-	this->m_MoveInfo.clear();
+	for (int n = 0; n < MAX_MOVE; n++)
+	{
+		this->m_MoveInfo[n].Index = -1;
+	}
 }
 
 CMove::~CMove()
@@ -43,7 +46,10 @@ void CMove::Load(const char* path)
 		return;
 	}
 
-	this->m_MoveInfo.clear();
+	for (int n = 0; n < MAX_MOVE; n++)
+	{
+		this->m_MoveInfo[n].Index = -1;
+	}
 
 	try
 	{
@@ -78,7 +84,17 @@ void CMove::Load(const char* path)
 
 			info.Gate = lpReadScript->GetAsNumber();
 
-			this->m_MoveInfo.insert(std::pair<int, MOVE_INFO>(info.Index, info));
+			if (info.Index < 0 || info.Index >= MAX_MOVE)
+			{
+				LogAdd(LOG_RED, "[Move] Move index %d out of range (0-%d)", info.Index, (MAX_MOVE - 1));
+
+				continue;
+			}
+
+			if (this->m_MoveInfo[info.Index].Index == -1)
+			{
+				this->m_MoveInfo[info.Index] = info;
+			}
 		}
 	}
 	catch (...)
@@ -89,31 +105,33 @@ void CMove::Load(const char* path)
 	delete lpReadScript;
 }
 
-bool CMove::GetInfo(int index, MOVE_INFO* lpInfo)
+MOVE_INFO* CMove::GetInfo(int index)
 {
-	std::map<int, MOVE_INFO>::iterator it = this->m_MoveInfo.find(index);
-
-	if (it == this->m_MoveInfo.end())
+	if (index < 0 || index >= MAX_MOVE)
 	{
 		return 0;
 	}
-	else
-	{
-		(*lpInfo) = it->second;
 
-		return 1;
+	if (this->m_MoveInfo[index].Index != index)
+	{
+		return 0;
 	}
+
+	return &this->m_MoveInfo[index];
 }
 
-bool CMove::GetInfoByName(char* name, MOVE_INFO* lpInfo)
+MOVE_INFO* CMove::GetInfoByName(char* name)
 {
-	for (std::map<int, MOVE_INFO>::iterator it = this->m_MoveInfo.begin(); it != this->m_MoveInfo.end(); it++)
+	for (int n = 0; n < MAX_MOVE; n++)
 	{
-		if (_stricmp(it->second.Name, name) == 0)
+		if (this->m_MoveInfo[n].Index != n)
 		{
-			(*lpInfo) = it->second;
+			continue;
+		}
 
-			return 1;
+		if (_stricmp(this->m_MoveInfo[n].Name, name) == 0)
+		{
+			return &this->m_MoveInfo[n];
 		}
 	}
 
@@ -122,49 +140,49 @@ bool CMove::GetInfoByName(char* name, MOVE_INFO* lpInfo)
 
 void CMove::Move(LPOBJ lpObj, int index)
 {
-	MOVE_INFO MoveInfo;
+	MOVE_INFO* lpMoveInfo = this->GetInfo(index);
 
-	if (this->GetInfo(index, &MoveInfo) == 0)
+	if (lpMoveInfo == 0)
 	{
 		return;
 	}
 
-	if (MoveInfo.MinLevel != -1 && lpObj->Level < gGate.GetMoveLevel(lpObj, gGate.GetGateMap(MoveInfo.Gate), MoveInfo.MinLevel))
+	if (lpMoveInfo->MinLevel != -1 && lpObj->Level < gGate.GetMoveLevel(lpObj, gGate.GetGateMap(lpMoveInfo->Gate), lpMoveInfo->MinLevel))
 	{
-		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(59, lpObj->Lang), gGate.GetMoveLevel(lpObj, gGate.GetGateMap(MoveInfo.Gate), MoveInfo.MinLevel));
+		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(59, lpObj->Lang), gGate.GetMoveLevel(lpObj, gGate.GetGateMap(lpMoveInfo->Gate), lpMoveInfo->MinLevel));
 
 		return;
 	}
 
-	if (MoveInfo.MaxLevel != -1 && lpObj->Level > MoveInfo.MaxLevel)
+	if (lpMoveInfo->MaxLevel != -1 && lpObj->Level > lpMoveInfo->MaxLevel)
 	{
-		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(60, lpObj->Lang), MoveInfo.MaxLevel);
+		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(60, lpObj->Lang), lpMoveInfo->MaxLevel);
 
 		return;
 	}
 
-	if (MoveInfo.MinReset != -1 && lpObj->Reset < MoveInfo.MinReset)
+	if (lpMoveInfo->MinReset != -1 && lpObj->Reset < lpMoveInfo->MinReset)
 	{
-		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(61, lpObj->Lang), MoveInfo.MinReset);
+		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(61, lpObj->Lang), lpMoveInfo->MinReset);
 
 		return;
 	}
 
-	if (MoveInfo.MaxReset != -1 && lpObj->Reset > MoveInfo.MaxReset)
+	if (lpMoveInfo->MaxReset != -1 && lpObj->Reset > lpMoveInfo->MaxReset)
 	{
-		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(62, lpObj->Lang), MoveInfo.MaxReset);
+		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(62, lpObj->Lang), lpMoveInfo->MaxReset);
 
 		return;
 	}
 
-	if (lpObj->Money < ((DWORD)MoveInfo.Money))
+	if (lpObj->Money < ((DWORD)lpMoveInfo->Money))
 	{
-		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(58, lpObj->Lang), MoveInfo.Money);
+		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(58, lpObj->Lang), lpMoveInfo->Money);
 
 		return;
 	}
 
-	if (lpObj->AccountLevel < MoveInfo.AccountLevel)
+	if (lpObj->AccountLevel < lpMoveInfo->AccountLevel)
 	{
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(57, lpObj->Lang));
 
@@ -185,30 +203,30 @@ void CMove::Move(LPOBJ lpObj, int index)
 		return;
 	}
 
-	if (gGate.GetGateMap(MoveInfo.Gate) == MAP_ATLANS && (lpObj->Inventory[8].m_Index == GET_ITEM(13, 2) || lpObj->Inventory[8].m_Index == GET_ITEM(13, 3))) // Uniria,Dinorant
+	if (gGate.GetGateMap(lpMoveInfo->Gate) == MAP_ATLANS && (lpObj->Inventory[8].m_Index == GET_ITEM(13, 2) || lpObj->Inventory[8].m_Index == GET_ITEM(13, 3))) // Uniria,Dinorant
 	{
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(67, lpObj->Lang));
 
 		return;
 	}
 
-	if (gGate.GetGateMap(MoveInfo.Gate) == MAP_ICARUS && (lpObj->Inventory[7].IsItem() == 0 && lpObj->Inventory[8].m_Index != GET_ITEM(13, 3))) // Wings
+	if (gGate.GetGateMap(lpMoveInfo->Gate) == MAP_ICARUS && (lpObj->Inventory[7].IsItem() == 0 && lpObj->Inventory[8].m_Index != GET_ITEM(13, 3))) // Wings
 	{
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(68, lpObj->Lang));
 
 		return;
 	}
 
-	if (gGate.GetGateMap(MoveInfo.Gate) == MAP_ICARUS && lpObj->Inventory[8].m_Index == GET_ITEM(13, 2)) // Uniria
+	if (gGate.GetGateMap(lpMoveInfo->Gate) == MAP_ICARUS && lpObj->Inventory[8].m_Index == GET_ITEM(13, 2)) // Uniria
 	{
 		gNotice.GCNoticeSend(lpObj->Index, 1, gMessage.GetTextMessage(67, lpObj->Lang));
 
 		return;
 	}
 
-	if (gObjMoveGate(lpObj->Index, MoveInfo.Gate) != 0)
+	if (gObjMoveGate(lpObj->Index, lpMoveInfo->Gate) != 0)
 	{
-		lpObj->Money -= MoveInfo.Money;
+		lpObj->Money -= lpMoveInfo->Money;
 
 		GCMoneySend(lpObj->Index, lpObj->Money);
 	}
@@ -317,23 +335,30 @@ void CMove::GCMoveListSend(LPOBJ lpObj)
 
 	MOVE_LIST_INFO info;
 
-	for (std::map<int, MOVE_INFO>::iterator it = this->m_MoveInfo.begin(); it != this->m_MoveInfo.end(); it++)
+	for (int n = 0; n < MAX_MOVE; n++)
 	{
-		info.MapNumber = gGate.GetGateMap(it->second.Gate);
+		MOVE_INFO* lpMoveInfo = &this->m_MoveInfo[n];
+
+		if (lpMoveInfo->Index != n)
+		{
+			continue;
+		}
+
+		info.MapNumber = gGate.GetGateMap(lpMoveInfo->Gate);
 
-		memcpy(info.MapName, it->second.Name, sizeof(info.MapName));
+		memcpy(info.MapName, lpMoveInfo->Name, sizeof(info.MapName));
 
-		info.MinLevel = gGate.GetMoveLevel(lpObj, info.MapNumber, it->second.MinLevel);
+		info.MinLevel = gGate.GetMoveLevel(lpObj, info.MapNumber, lpMoveInfo->MinLevel);
 
-		info.MaxLevel = it->second.MaxLevel;
+		info.MaxLevel = lpMoveInfo->MaxLevel;
 
-		info.MinReset = it->second.MinReset;
+		info.MinReset = lpMoveInfo->MinReset;
 
-		info.MaxReset = it->second.MaxReset;
+		info.MaxReset = lpMoveInfo->MaxReset;
 
-		info.AccountLevel = it->second.AccountLevel;
+		info.AccountLevel = lpMoveInfo->AccountLevel;
 
-		info.Money = it->second.Money;
+		info.Money = lpMoveInfo->Money;
 
 		info.CanMove = true;
 
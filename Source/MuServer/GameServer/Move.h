@@ -78,9 +78,9 @@ public:
 
 	void Load(const char* path);
 
-	bool GetInfo(int index, MOVE_INFO* lpInfo);
+	MOVE_INFO* GetInfo(int index);
 
-	bool GetInfoByName(char* name, MOVE_INFO* lpInfo);
+	MOVE_INFO* GetInfoByName(char* name);
 
 	void Move(LPOBJ lpObj, int index);
 
@@ -94,7 +94,7 @@ public:
 
 private:
 
-	std::map<int, MOVE_INFO> m_MoveInfo;
+	MOVE_INFO m_MoveInfo[MAX_MOVE];
 };
 
 extern CMove gMove;
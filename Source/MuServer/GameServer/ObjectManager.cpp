@@ -33,12 +33,19 @@
 #include "SkillManager.h"
 #include "Trade.h"
 #include "Util.h"
+#include "Viewport.h"
 
 CObjectManager gObjectManager;
 
 CObjectManager::CObjectManager()
 {
+	this->m_IdleTickCount = 0;
 
+	this->m_MsgSerial = 0;
+
+	memset(this->m_MsgGeneration, 0, sizeof(this->m_MsgGeneration));
+
+	this->m_CalcAttributeSerial = 0;
 }
 
 CObjectManager::~CObjectManager()
@@ -46,44 +53,165 @@ CObjectManager::~CObjectManager()
 
 }
 
-void CObjectManager::ObjectMsgProc(LPOBJ lpObj)
+bool ObjectMsgCompare(const OBJECT_MSG_INFO& a, const OBJECT_MSG_INFO& b)
 {
-	for (int n = 0; n < MAX_MONSTER_SEND_MSG; n++)
+	if (a.Deadline != b.Deadline)
 	{
-		if (gSMMsg[lpObj->Index][n].MsgCode != -1 && GetTickCount() > ((DWORD)gSMMsg[lpObj->Index][n].MsgTime))
+		return ((int)(a.Deadline - b.Deadline) > 0);
+	}
+
+	return ((int)(a.Serial - b.Serial) > 0);
+}
+
+void CObjectManager::ObjectMsgSchedule(int aIndex, int MsgCode, int SendUser, int MsgTimeDelay, int SubCode)
+{
+	OBJECT_MSG_INFO info;
+
+	info.Deadline = GetTickCount() + MsgTimeDelay;
+
+	info.Index = aIndex;
+
+	info.MsgCode = MsgCode;
+
+	info.SendUser = SendUser;
+
+	info.SubCode = SubCode;
+
+	info.SubCode2 = 0;
+
+	this->m_MsgCritical.lock();
+
+	info.Serial = this->m_MsgSerial++;
+
+	info.Generation = this->m_MsgGeneration[aIndex];
+
+	this->m_MsgHeap.push_back(info);
+
+	std::push_heap(this->m_MsgHeap.begin(), this->m_MsgHeap.end(), ObjectMsgCompare);
+
+	this->m_MsgCritical.unlock();
+}
+
+void CObjectManager::ObjectAttackMsgSchedule(int aIndex, int MsgCode, int SendUser, int MsgTimeDelay, int SubCode, int SubCode2)
+{
+	OBJECT_MSG_INFO info;
+
+	info.Deadline = GetTickCount() + MsgTimeDelay;
+
+	info.Index = aIndex;
+
+	info.MsgCode = MsgCode;
+
+	info.SendUser = SendUser;
+
+	info.SubCode = SubCode;
+
+	info.SubCode2 = SubCode2;
+
+	this->m_MsgCritical.lock();
+
+	info.Serial = this->m_MsgSerial++;
+
+	info.Generation = this->m_MsgGeneration[aIndex];
+
+	this->m_AttackMsgHeap.push_back(info);
+
+	std::push_heap(this->m_AttackMsgHeap.begin(), this->m_AttackMsgHeap.end(), ObjectMsgCompare);
+
+	this->m_MsgCritical.unlock();
+}
+
+void CObjectManager::ObjectMsgClear(int aIndex)
+{
+	this->m_MsgCritical.lock();
+
+	this->m_MsgGeneration[aIndex]++;
+
+	this->m_MsgCritical.unlock();
+}
+
+void CObjectManager::ObjectMsgProc()
+{
+	std::vector<OBJECT_MSG_INFO> MsgList;
+
+	DWORD CurrentTime = GetTickCount();
+
+	this->m_MsgCritical.lock();
+
+	while (this->m_MsgHeap.empty() == 0 && (int)(CurrentTime - this->m_MsgHeap.front().Deadline) > 0)
+	{
+		std::pop_heap(this->m_MsgHeap.begin(), this->m_MsgHeap.end(), ObjectMsgCompare);
+
+		if (this->m_MsgHeap.back().Generation == this->m_MsgGeneration[this->m_MsgHeap.back().Index])
 		{
-			if (lpObj->Type == OBJECT_MONSTER || lpObj->Type == OBJECT_NPC)
-			{
-				gObjMonsterStateProc(lpObj, gSMMsg[lpObj->Index][n].MsgCode, gSMMsg[lpObj->Index][n].SendUser, gSMMsg[lpObj->Index][n].SubCode);
+			MsgList.push_back(this->m_MsgHeap.back());
+		}
 
-				gSMMsg[lpObj->Index][n].Clear();
-			}
-			else
-			{
-				this->ObjectStateProc(lpObj, gSMMsg[lpObj->Index][n].MsgCode, gSMMsg[lpObj->Index][n].SendUser, gSMMsg[lpObj->Index][n].SubCode);
+		this->m_MsgHeap.pop_back();
+	}
 
-				gSMMsg[lpObj->Index][n].Clear();
-			}
+	this->m_MsgCritical.unlock();
+
+	for (std::vector<OBJECT_MSG_INFO>::iterator it = MsgList.begin(); it != MsgList.end(); it++)
+	{
+		if (gObjIsConnected(it->Index) == 0)
+		{
+			continue;
+		}
+
+		LPOBJ lpObj = &gObj[it->Index];
+
+		if (lpObj->Type == OBJECT_MONSTER || lpObj->Type == OBJECT_NPC)
+		{
+			gObjMonsterStateProc(lpObj, it->MsgCode, it->SendUser, it->SubCode);
+		}
+		else
+		{
+			this->ObjectStateProc(lpObj, it->MsgCode, it->SendUser, it->SubCode);
 		}
 	}
 }
 
-void CObjectManager::ObjectSetStateCreate(int aIndex)
+void CObjectManager::ObjectAttackMsgProc()
 {
-	LPOBJ lpObj = &gObj[aIndex];
+	std::vector<OBJECT_MSG_INFO> MsgList;
 
-	if (gObjIsConnected(aIndex) == 0)
+	DWORD CurrentTime = GetTickCount();
+
+	this->m_MsgCritical.lock();
+
+	while (this->m_AttackMsgHeap.empty() == 0 && (int)(CurrentTime - this->m_AttackMsgHeap.front().Deadline) > 0)
 	{
-		return;
+		std::pop_heap(this->m_AttackMsgHeap.begin(), this->m_AttackMsgHeap.end(), ObjectMsgCompare);
+
+		if (this->m_AttackMsgHeap.back().Generation == this->m_MsgGeneration[this->m_AttackMsgHeap.back().Index])
+		{
+			MsgList.push_back(this->m_AttackMsgHeap.back());
+		}
+
+		this->m_AttackMsgHeap.pop_back();
 	}
 
-	if (lpObj->DieRegen == 1 && (GetTickCount() - lpObj->RegenTime) > (lpObj->MaxRegenTime + 1000))
+	this->m_MsgCritical.unlock();
+
+	for (std::vector<OBJECT_MSG_INFO>::iterator it = MsgList.begin(); it != MsgList.end(); it++)
 	{
-		lpObj->DieRegen = 2;
+		if (gObjIsConnected(it->Index) == 0)
+		{
+			continue;
+		}
 
-		lpObj->State = OBJECT_DIECMD;
+		this->ObjectStateAttackProc(&gObj[it->Index], it->MsgCode, it->SendUser, it->SubCode, it->SubCode2);
+	}
+}
 
-		this->CharacterCalcAttribute(aIndex);
+void CObjectManager::ObjectSetStateCreate(int aIndex)
+{
+	LPOBJ lpObj = &gObj[aIndex];
+
+	if (gObjIsConnected(aIndex) == 0)
+	{
+		return;
 	}
 
 	if (lpObj->Type == OBJECT_USER && lpObj->Teleport == 2)
@@ -184,10 +312,88 @@ void CObjectManager::ObjectSetStateCreate(int aIndex)
 	}
 }
 
+bool ObjectRegenCompare(const OBJECT_REGEN_INFO& a, const OBJECT_REGEN_INFO& b)
+{
+	return ((int)(a.Deadline - b.Deadline) > 0);
+}
+
+void CObjectManager::ObjectRegenSchedule(LPOBJ lpObj)
+{
+	OBJECT_REGEN_INFO info;
+
+	info.Deadline = lpObj->RegenTime + lpObj->MaxRegenTime + 1001;
+
+	info.RegenTime = lpObj->RegenTime;
+
+	info.Index = lpObj->Index;
+
+	this->m_RegenCritical.lock();
+
+	this->m_RegenHeap.push_back(info);
+
+	std::push_heap(this->m_RegenHeap.begin(), this->m_RegenHeap.end(), ObjectRegenCompare);
+
+	this->m_RegenCritical.unlock();
+}
+
+void CObjectManager::ObjectRegenProc()
+{
+	std::vector<OBJECT_REGEN_INFO> RegenList;
+
+	DWORD CurrentTime = GetTickCount();
+
+	this->m_RegenCritical.lock();
+
+	while (this->m_RegenHeap.empty() == 0 && (int)(CurrentTime - this->m_RegenHeap.front().Deadline) >= 0)
+	{
+		std::pop_heap(this->m_RegenHeap.begin(), this->m_RegenHeap.end(), ObjectRegenCompare);
+
+		RegenList.push_back(this->m_RegenHeap.back());
+
+		this->m_RegenHeap.pop_back();
+	}
+
+	this->m_RegenCritical.unlock();
+
+	for (std::vector<OBJECT_REGEN_INFO>::iterator it = RegenList.begin(); it != RegenList.end(); it++)
+	{
+		if (gObjIsConnected(it->Index) == 0)
+		{
+			continue;
+		}
+
+		LPOBJ lpObj = &gObj[it->Index];
+
+		if (lpObj->DieRegen != 1 || lpObj->RegenTime != it->RegenTime)
+		{
+			continue;
+		}
+
+		if ((GetTickCount() - lpObj->RegenTime) > (lpObj->MaxRegenTime + 1000))
+		{
+			lpObj->DieRegen = 2;
+
+			lpObj->State = OBJECT_DIECMD;
+
+			this->CharacterCalcAttribute(it->Index);
+		}
+		else
+		{
+			this->ObjectRegenSchedule(lpObj);
+		}
+	}
+}
+
 void CObjectManager::ObjectSetStateProc()
 {
-	for (int n = 0; n < MAX_OBJECT; n++)
+	OBJECT_ACTIVE_LIST ActiveList;
+
+	gObjGetActiveList(&ActiveList, OBJECT_START_MONSTER, MAX_OBJECT);
+
+	for (int i = 0; i < ActiveList.Count; i++)
 	{
+		int n = ActiveList.Index[i];
+
 		if (gObjIsConnected(n) == 0)
 		{
 			continue;
@@ -480,8 +686,14 @@ void CObjectManager::ObjectStateAttackProc(LPOBJ lpObj, int MessageCode, int aIn
 
 void CObjectManager::ObjectMoveProc()
 {
-	for (int n = 0; n < MAX_OBJECT; n++)
+	OBJECT_ACTIVE_LIST ActiveList;
+
+	gObjGetActiveList(&ActiveList, OBJECT_START_MONSTER, MAX_OBJECT);
+
+	for (int i = 0; i < ActiveList.Count; i++)
 	{
+		int n = ActiveList.Index[i];
+
 		if (gObjIsConnected(n) == 0)
 		{
 			continue;
@@ -517,7 +729,7 @@ void CObjectManager::ObjectMoveProc()
 
 		if ((GetTickCount() - lpObj->PathTime) > MoveTime && lpObj->PathCur < (MAX_ROAD_PATH_TABLE - 1))
 		{
-			if (gMap[lpObj->Map].CheckAttr(lpObj->PathX[lpObj->PathCur], lpObj->PathY[lpObj->PathCur], 4) != 0 || gMap[lpObj->Map].CheckAttr(lpObj->PathX[lpObj->PathCur], lpObj->PathY[lpObj->PathCur], 8) != 0)
+			if (gMap[lpObj->Map].CheckWalkAttr(lpObj->PathX[lpObj->PathCur], lpObj->PathY[lpObj->PathCur]) == 0)
 			{
 				lpObj->PathCur = 0;
 
@@ -560,38 +772,100 @@ void CObjectManager::ObjectMoveProc()
 
 void CObjectManager::ObjectMonsterAndMsgProc()
 {
-	for (int n = 0; n < MAX_OBJECT; n++)
+	OBJECT_ACTIVE_LIST ActiveList;
+
+	this->ObjectActiveRegionProc();
+
+	this->m_IdleTickCount++;
+
+	this->ObjectMsgProc();
+
+	gObjGetActiveList(&ActiveList, OBJECT_START_MONSTER, MAX_OBJECT);
+
+	for (int i = 0; i < ActiveList.Count; i++)
 	{
-		if (gObjIsConnected(n) != 0)
+		int n = ActiveList.Index[i];
+
+		if (gObjIsConnected(n) == 0)
 		{
-			if (gObj[n].Type == OBJECT_MONSTER || gObj[n].Type == OBJECT_NPC)
-			{
-				gObjMonsterProcess(&gObj[n]);
-			}
-			else
-			{
-				gObjectManager.ObjectMsgProc(&gObj[n]);
-			}
+			continue;
 		}
+
+		if (gObj[n].Type != OBJECT_MONSTER && gObj[n].Type != OBJECT_NPC)
+		{
+			continue;
+		}
+
+		if (gServerInfo.m_MonsterIdleTickRate > 0 && ((this->m_IdleTickCount + n) % gServerInfo.m_MonsterIdleTickRate) != 0 && this->ObjectCheckIdle(&gObj[n]) != 0)
+		{
+			continue;
+		}
+
+		gObjMonsterProcess(&gObj[n]);
+	}
+
+	this->ObjectAttackMsgProc();
+}
+
+void CObjectManager::ObjectActiveRegionProc()
+{
+	if (gServerInfo.m_MonsterIdleSwitch == 0)
+	{
+		return;
+	}
+
+	for (int n = 0; n < MAX_MAP; n++)
+	{
+		gMap[n].ClearActiveRegion(gMap[n].m_EventMap);
 	}
 
-	for (int n = 0; n < MAX_OBJECT; n++)
+	OBJECT_ACTIVE_LIST ActiveList;
+
+	gObjGetActiveList(&ActiveList, OBJECT_START_USER, MAX_OBJECT);
+
+	for (int i = 0; i < ActiveList.Count; i++)
 	{
-		if (gObjIsConnected(n) != 0)
+		LPOBJ lpObj = &gObj[ActiveList.Index[i]];
+
+		if (lpObj->Connected != OBJECT_ONLINE || lpObj->Type != OBJECT_USER)
 		{
-			for (int i = 0; i < MAX_MONSTER_SEND_ATTACK_MSG; i++)
-			{
-				if (gSMAttackProcMsg[n][i].MsgCode != -1 && GetTickCount() > ((DWORD)gSMAttackProcMsg[n][i].MsgTime))
-				{
-					gObjectManager.ObjectStateAttackProc(&gObj[n], gSMAttackProcMsg[n][i].MsgCode, gSMAttackProcMsg[n][i].SendUser, gSMAttackProcMsg[n][i].SubCode, gSMAttackProcMsg[n][i].SubCode2);
+			continue;
+		}
 
-					gSMAttackProcMsg[n][i].Clear();
-				}
-			}
+		if (MAP_RANGE(lpObj->Map) == 0)
+		{
+			continue;
 		}
+
+		gMap[lpObj->Map].SetActiveRegion(lpObj->X, lpObj->Y, (gMapManager.GetMapViewRange(lpObj->Map) + MAP_REGION_SIZE));
 	}
 }
 
+bool CObjectManager::ObjectCheckIdle(LPOBJ lpObj)
+{
+	if (gServerInfo.m_MonsterIdleSwitch == 0)
+	{
+		return 0;
+	}
+
+	if (OBJECT_MONSTER_RANGE(lpObj->Index) == 0)
+	{
+		return 0;
+	}
+
+	if (lpObj->Type != OBJECT_MONSTER && lpObj->Type != OBJECT_NPC)
+	{
+		return 0;
+	}
+
+	if (lpObj->TargetNumber >= 0 || MAP_RANGE(lpObj->Map) == 0)
+	{
+		return 0;
+	}
+
+	return (gMap[lpObj->Map].CheckActiveRegion(lpObj->X, lpObj->Y) == 0);
+}
+
 bool CObjectManager::CharacterGameClose(int aIndex)
 {
 	if (OBJECT_RANGE(aIndex) == 0)
@@ -677,6 +951,8 @@ bool CObjectManager::CharacterGameClose(int aIndex)
 
 	gLog.Output(LOG_CONNECT, "[ObjectManager][%d] DelCharacterInfo (%s)", lpObj->Index, lpObj->Name);
 
+	gObjNameIndexRemove(aIndex);
+
 	memset(lpObj->Name, 0, sizeof(lpObj->Name));
 
 	lpObj->Connected = OBJECT_LOGGED;
@@ -1116,6 +1392,8 @@ void CObjectManager::CharacterMakePreviewCharSet(int aIndex)
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
+	gViewport.ClearViewportRecord(lpObj);
+
 	memset(lpObj->CharSet, 0, sizeof(lpObj->CharSet));
 
 	lpObj->CharSet[0] = (lpObj->ChangeUp * 16);
@@ -1832,14 +2110,14 @@ void CObjectManager::CharacterItemDurationDown(LPOBJ lpObj)
 			{
 				case 7:
 				{
-					result = lpObj->Inventory[n].WingDurabilityDown(lpObj->Index, ((gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) == 0) ? 1 : 0));
+					result = lpObj->Inventory[n].WingDurabilityDown(lpObj->Index, ((gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) == 0) ? 1 : 0));
 
 					break;
 				}
 
 				case 9:
 				{
-					result = lpObj->Inventory[n].PendantDurabilityDown(lpObj->Index, ((gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) == 0) ? 1 : 0));
+					result = lpObj->Inventory[n].PendantDurabilityDown(lpObj->Index, ((gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) == 0) ? 1 : 0));
 
 					break;
 				}
@@ -1869,7 +2147,7 @@ void CObjectManager::CharacterItemDurationDown(LPOBJ lpObj)
 
 				default:
 				{
-					result = lpObj->Inventory[n].RingDurabilityDown(lpObj->Index, ((gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) == 0) ? 1 : 0));
+					result = lpObj->Inventory[n].RingDurabilityDown(lpObj->Index, ((gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) == 0) ? 1 : 0));
 
 					break;
 				}
@@ -1924,6 +2202,263 @@ void CObjectManager::CharacterCalcBP(LPOBJ lpObj)
 	}
 }
 
+void CObjectManager::CharacterCalcAttributeReset()
+{
+	this->m_CalcAttributeSerial++;
+}
+
+void CObjectManager::CharacterCalcAttributeClear(LPOBJ lpObj)
+{
+	CHARACTER_CALC_CACHE* lpCache = &lpObj->UserData->CalcCache;
+
+	memset(lpCache, 0, sizeof(CHARACTER_CALC_CACHE));
+
+	lpCache->Key.Serial = -1;
+
+	for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+	{
+		lpCache->Item[n].Index = -1;
+	}
+}
+
+void CObjectManager::CharacterCalcAttributeCheck(LPOBJ lpObj)
+{
+	CHARACTER_CALC_KEY key;
+
+	memset(&key, 0, sizeof(key));
+
+	key.Serial = this->m_CalcAttributeSerial;
+
+	key.Class = lpObj->Class;
+
+	key.ChangeUp = lpObj->ChangeUp;
+
+	key.Level = lpObj->Level;
+
+	key.Strength = lpObj->Strength;
+
+	key.Dexterity = lpObj->Dexterity;
+
+	key.Vitality = lpObj->Vitality;
+
+	key.Energy = lpObj->Energy;
+
+	key.VitalityToLife = lpObj->VitalityToLife;
+
+	key.EnergyToMana = lpObj->EnergyToMana;
+
+	if (memcmp(&lpObj->UserData->CalcCache.Key, &key, sizeof(key)) != 0)
+	{
+		this->CharacterCalcAttributeClear(lpObj);
+
+		lpObj->UserData->CalcCache.Key = key;
+	}
+}
+
+CHARACTER_CALC_BASE* CObjectManager::CharacterCalcBaseLayer(LPOBJ lpObj, bool bow)
+{
+	CHARACTER_CALC_BASE* lpBase = &lpObj->UserData->CalcCache.Base;
+
+	if (lpBase->Valid != 0 && lpBase->Bow == bow)
+	{
+		return lpBase;
+	}
+
+	lpBase->Valid = 1;
+
+	lpBase->Bow = bow;
+
+	int Strength = lpObj->Strength;
+
+	int Dexterity = lpObj->Dexterity;
+
+	int Energy = lpObj->Energy;
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpBase->PhysiDamageMin = Strength / gServerInfo.m_DWPhysiDamageMinConstA;
+
+		lpBase->PhysiDamageMax = Strength / gServerInfo.m_DWPhysiDamageMaxConstA;
+
+		lpBase->MagicDamageMin = Energy / gServerInfo.m_DWMagicDamageMinConstA;
+
+		lpBase->MagicDamageMax = Energy / gServerInfo.m_DWMagicDamageMaxConstA;
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpBase->PhysiDamageMin = Strength / gServerInfo.m_DKPhysiDamageMinConstA;
+
+		lpBase->PhysiDamageMax = Strength / gServerInfo.m_DKPhysiDamageMaxConstA;
+
+		lpBase->MagicDamageMin = Energy / gServerInfo.m_DKMagicDamageMinConstA;
+
+		lpBase->MagicDamageMax = Energy / gServerInfo.m_DKMagicDamageMaxConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		if (bow != 0)
+		{
+			lpBase->PhysiDamageMin = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
+
+			lpBase->PhysiDamageMax = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
+		}
+		else
+		{
+			lpBase->PhysiDamageMin = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMinConstA;
+
+			lpBase->PhysiDamageMax = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMaxConstA;
+		}
+
+		lpBase->MagicDamageMin = Energy / gServerInfo.m_FEMagicDamageMinConstA;
+
+		lpBase->MagicDamageMax = Energy / gServerInfo.m_FEMagicDamageMaxConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpBase->PhysiDamageMin = (Strength / gServerInfo.m_MGPhysiDamageMinConstA) + (Energy / gServerInfo.m_MGPhysiDamageMinConstB);
+
+		lpBase->PhysiDamageMax = (Strength / gServerInfo.m_MGPhysiDamageMaxConstA) + (Energy / gServerInfo.m_MGPhysiDamageMaxConstB);
+
+		lpBase->MagicDamageMin = Energy / gServerInfo.m_MGMagicDamageMinConstA;
+
+		lpBase->MagicDamageMax = Energy / gServerInfo.m_MGMagicDamageMaxConstA;
+	}
+
+	lpBase->DamageMultiplierRate = 200 + (Energy / gServerInfo.m_DamageMultiplierConstA[lpObj->Class]);
+
+	lpBase->DamageMultiplierRate = ((lpBase->DamageMultiplierRate > gServerInfo.m_DamageMultiplierMaxRate[lpObj->Class]) ? gServerInfo.m_DamageMultiplierMaxRate[lpObj->Class] : lpBase->DamageMultiplierRate);
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpBase->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_DWAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_DWAttackSuccessRateConstB) / gServerInfo.m_DWAttackSuccessRateConstC) + (Strength / gServerInfo.m_DWAttackSuccessRateConstD);
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpBase->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_DKAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_DKAttackSuccessRateConstB) / gServerInfo.m_DKAttackSuccessRateConstC) + (Strength / gServerInfo.m_DKAttackSuccessRateConstD);
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpBase->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_FEAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_FEAttackSuccessRateConstB) / gServerInfo.m_FEAttackSuccessRateConstC) + (Strength / gServerInfo.m_FEAttackSuccessRateConstD);
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpBase->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_MGAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_MGAttackSuccessRateConstB) / gServerInfo.m_MGAttackSuccessRateConstC) + (Strength / gServerInfo.m_MGAttackSuccessRateConstD);
+	}
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpBase->PhysiSpeed = Dexterity / gServerInfo.m_DWPhysiSpeedConstA;
+
+		lpBase->MagicSpeed = Dexterity / gServerInfo.m_DWMagicSpeedConstA;
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpBase->PhysiSpeed = Dexterity / gServerInfo.m_DKPhysiSpeedConstA;
+
+		lpBase->MagicSpeed = Dexterity / gServerInfo.m_DKMagicSpeedConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpBase->PhysiSpeed = Dexterity / gServerInfo.m_FEPhysiSpeedConstA;
+
+		lpBase->MagicSpeed = Dexterity / gServerInfo.m_FEMagicSpeedConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpBase->PhysiSpeed = Dexterity / gServerInfo.m_MGPhysiSpeedConstA;
+
+		lpBase->MagicSpeed = Dexterity / gServerInfo.m_MGMagicSpeedConstA;
+	}
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpBase->DefenseSuccessRate = Dexterity / gServerInfo.m_DWDefenseSuccessRateConstA;
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpBase->DefenseSuccessRate = Dexterity / gServerInfo.m_DKDefenseSuccessRateConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpBase->DefenseSuccessRate = Dexterity / gServerInfo.m_FEDefenseSuccessRateConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpBase->DefenseSuccessRate = Dexterity / gServerInfo.m_MGDefenseSuccessRateConstA;
+	}
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpBase->Defense = Dexterity / gServerInfo.m_DWDefenseConstA;
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpBase->Defense = Dexterity / gServerInfo.m_DKDefenseConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpBase->Defense = Dexterity / gServerInfo.m_FEDefenseConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpBase->Defense = Dexterity / gServerInfo.m_MGDefenseConstA;
+	}
+
+	lpBase->MaxLife = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].MaxLife;
+
+	lpBase->MaxMana = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].MaxMana;
+
+	lpBase->MaxLife += gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].LevelLife * (lpObj->Level - 1);
+
+	lpBase->MaxMana += gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].LevelMana * (lpObj->Level - 1);
+
+	lpBase->MaxLife += ((lpObj->Vitality - gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].Vitality)) * lpObj->VitalityToLife;
+
+	lpBase->MaxMana += ((lpObj->Energy - gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].Energy)) * lpObj->EnergyToMana;
+
+	return lpBase;
+}
+
+void CObjectManager::CharacterCalcItemLayer(LPOBJ lpObj)
+{
+	CHARACTER_CALC_CACHE* lpCache = &lpObj->UserData->CalcCache;
+
+	for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+	{
+		CItem* lpItem = &lpObj->Inventory[n];
+
+		if (lpItem->IsItem() == 0)
+		{
+			lpItem->m_IsValidItem = 0;
+
+			continue;
+		}
+
+		CHARACTER_CALC_ITEM* lpInfo = &lpCache->Item[n];
+
+		if (lpInfo->Index != lpItem->m_Index || lpInfo->Durability != (lpItem->m_Durability != 0) || lpInfo->RequireLevel != lpItem->m_RequireLevel || lpInfo->RequireStrength != lpItem->m_RequireStrength || lpInfo->RequireDexterity != lpItem->m_RequireDexterity || lpInfo->RequireVitality != lpItem->m_RequireVitality || lpInfo->RequireEnergy != lpItem->m_RequireEnergy)
+		{
+			lpInfo->Index = lpItem->m_Index;
+
+			lpInfo->Durability = (lpItem->m_Durability != 0);
+
+			lpInfo->RequireLevel = lpItem->m_RequireLevel;
+
+			lpInfo->RequireStrength = lpItem->m_RequireStrength;
+
+			lpInfo->RequireDexterity = lpItem->m_RequireDexterity;
+
+			lpInfo->RequireVitality = lpItem->m_RequireVitality;
+
+			lpInfo->RequireEnergy = lpItem->m_RequireEnergy;
+
+			lpInfo->Valid = gItemManager.IsValidItem(lpObj, lpItem);
+		}
+
+		lpItem->m_IsValidItem = lpInfo->Valid;
+	}
+}
+
 void CObjectManager::CharacterCalcAttribute(int aIndex)
 {
 	LPOBJ lpObj = &gObj[aIndex];
@@ -1992,13 +2527,7 @@ void CObjectManager::CharacterCalcAttribute(int aIndex)
 		}
 	}
 
-	for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
-	{
-		if (lpObj->Inventory[n].IsItem() != 0)
-		{
-			lpObj->Inventory[n].m_IsValidItem = 1;
-		}
-	}
+	this->CharacterCalcAttributeCheck(lpObj);
 
 	lpObj->AddLife = 0;
 
@@ -2010,117 +2539,37 @@ void CObjectManager::CharacterCalcAttribute(int aIndex)
 
 	gObjClearSpecialOption(lpObj);
 
-	bool change = 1;
-
-	while (change != 0)
-	{
-		change = 0;
-
-		for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
-		{
-			if (lpObj->Inventory[n].m_IsValidItem != 0)
-			{
-				if (gItemManager.IsValidItem(lpObj, &lpObj->Inventory[n]) == 0)
-				{
-					change = 1;
-
-					lpObj->Inventory[n].m_IsValidItem = 0;
-				}
-			}
-		}
-	}
-
-	int Strength = lpObj->Strength;
-
-	int Dexterity = lpObj->Dexterity;
-
-	int Vitality = lpObj->Vitality;
-
-	int Energy = lpObj->Energy;
-
-	if (lpObj->Class == CLASS_DW)
-	{
-		lpObj->PhysiDamageMinRight = Strength / gServerInfo.m_DWPhysiDamageMinConstA;
-
-		lpObj->PhysiDamageMaxRight = Strength / gServerInfo.m_DWPhysiDamageMaxConstA;
-
-		lpObj->PhysiDamageMinLeft = Strength / gServerInfo.m_DWPhysiDamageMinConstA;
-
-		lpObj->PhysiDamageMaxLeft = Strength / gServerInfo.m_DWPhysiDamageMaxConstA;
+	this->CharacterCalcItemLayer(lpObj);
 
-		lpObj->MagicDamageMin = Energy / gServerInfo.m_DWMagicDamageMinConstA;
+	bool bow = 0;
 
-		lpObj->MagicDamageMax = Energy / gServerInfo.m_DWMagicDamageMaxConstA;
-	}
-	else if (lpObj->Class == CLASS_DK)
-	{
-		lpObj->PhysiDamageMinRight = Strength / gServerInfo.m_DKPhysiDamageMinConstA;
-
-		lpObj->PhysiDamageMaxRight = Strength / gServerInfo.m_DKPhysiDamageMaxConstA;
-
-		lpObj->PhysiDamageMinLeft = Strength / gServerInfo.m_DKPhysiDamageMinConstA;
-
-		lpObj->PhysiDamageMaxLeft = Strength / gServerInfo.m_DKPhysiDamageMaxConstA;
-
-		lpObj->MagicDamageMin = Energy / gServerInfo.m_DKMagicDamageMinConstA;
-
-		lpObj->MagicDamageMax = Energy / gServerInfo.m_DKMagicDamageMaxConstA;
-	}
-	else if (lpObj->Class == CLASS_FE)
+	if (lpObj->Class == CLASS_FE)
 	{
 		if (Right->IsItem() != 0 && Right->m_Index >= GET_ITEM(4, 0) && Right->m_Index < GET_ITEM(5, 0) && Right->m_Index != GET_ITEM(4, 15))
 		{
-			lpObj->PhysiDamageMinRight = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
-
-			lpObj->PhysiDamageMaxRight = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
-
-			lpObj->PhysiDamageMinLeft = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
-
-			lpObj->PhysiDamageMaxLeft = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
+			bow = 1;
 		}
 		else if (Left->IsItem() != 0 && Left->m_Index >= GET_ITEM(4, 0) && Left->m_Index < GET_ITEM(5, 0) && Left->m_Index != GET_ITEM(4, 7))
 		{
-			lpObj->PhysiDamageMinRight = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
-
-			lpObj->PhysiDamageMaxRight = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
-
-			lpObj->PhysiDamageMinLeft = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
-
-			lpObj->PhysiDamageMaxLeft = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
+			bow = 1;
 		}
-		else
-		{
-			lpObj->PhysiDamageMinRight = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMinConstA;
-
-			lpObj->PhysiDamageMaxRight = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMaxConstA;
-
-			lpObj->PhysiDamageMinLeft = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMinConstA;
-
-			lpObj->PhysiDamageMaxLeft = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMaxConstA;
-		}
-
-		lpObj->MagicDamageMin = Energy / gServerInfo.m_FEMagicDamageMinConstA;
-
-		lpObj->MagicDamageMax = Energy / gServerInfo.m_FEMagicDamageMaxConstA;
 	}
-	else if (lpObj->Class == CLASS_MG)
-	{
-		lpObj->PhysiDamageMinRight = (Strength / gServerInfo.m_MGPhysiDamageMinConstA) + (Energy / gServerInfo.m_MGPhysiDamageMinConstB);
 
-		lpObj->PhysiDamageMaxRight = (Strength / gServerInfo.m_MGPhysiDamageMaxConstA) + (Energy / gServerInfo.m_MGPhysiDamageMaxConstB);
+	CHARACTER_CALC_BASE* lpBase = this->CharacterCalcBaseLayer(lpObj, bow);
 
-		lpObj->PhysiDamageMinLeft = (Strength / gServerInfo.m_MGPhysiDamageMinConstA) + (Energy / gServerInfo.m_MGPhysiDamageMinConstB);
+	lpObj->PhysiDamageMinRight = lpBase->PhysiDamageMin;
 
-		lpObj->PhysiDamageMaxLeft = (Strength / gServerInfo.m_MGPhysiDamageMaxConstA) + (Energy / gServerInfo.m_MGPhysiDamageMaxConstB);
+	lpObj->PhysiDamageMaxRight = lpBase->PhysiDamageMax;
 
-		lpObj->MagicDamageMin = Energy / gServerInfo.m_MGMagicDamageMinConstA;
+	lpObj->PhysiDamageMinLeft = lpBase->PhysiDamageMin;
 
-		lpObj->MagicDamageMax = Energy / gServerInfo.m_MGMagicDamageMaxConstA;
-	}
+	lpObj->PhysiDamageMaxLeft = lpBase->PhysiDamageMax;
+
+	lpObj->MagicDamageMin = lpBase->MagicDamageMin;
 
-	lpObj->DamageMultiplierRate = 200 + (Energy / gServerInfo.m_DamageMultiplierConstA[lpObj->Class]);
+	lpObj->MagicDamageMax = lpBase->MagicDamageMax;
 
-	lpObj->DamageMultiplierRate = ((lpObj->DamageMultiplierRate > gServerInfo.m_DamageMultiplierMaxRate[lpObj->Class]) ? gServerInfo.m_DamageMultiplierMaxRate[lpObj->Class] : lpObj->DamageMultiplierRate);
+	lpObj->DamageMultiplierRate = lpBase->DamageMultiplierRate;
 
 	if (Right->IsItem() != 0)
 	{
@@ -2136,47 +2585,11 @@ void CObjectManager::CharacterCalcAttribute(int aIndex)
 		lpObj->PhysiDamageMaxLeft += Left->GetDamageMax();
 	}
 
-	if (lpObj->Class == CLASS_DW)
-	{
-		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_DWAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_DWAttackSuccessRateConstB) / gServerInfo.m_DWAttackSuccessRateConstC) + (Strength / gServerInfo.m_DWAttackSuccessRateConstD);
-	}
-	else if (lpObj->Class == CLASS_DK)
-	{
-		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_DKAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_DKAttackSuccessRateConstB) / gServerInfo.m_DKAttackSuccessRateConstC) + (Strength / gServerInfo.m_DKAttackSuccessRateConstD);
-	}
-	else if (lpObj->Class == CLASS_FE)
-	{
-		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_FEAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_FEAttackSuccessRateConstB) / gServerInfo.m_FEAttackSuccessRateConstC) + (Strength / gServerInfo.m_FEAttackSuccessRateConstD);
-	}
-	else if (lpObj->Class == CLASS_MG)
-	{
-		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_MGAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_MGAttackSuccessRateConstB) / gServerInfo.m_MGAttackSuccessRateConstC) + (Strength / gServerInfo.m_MGAttackSuccessRateConstD);
-	}
-
-	if (lpObj->Class == CLASS_DW)
-	{
-		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_DWPhysiSpeedConstA;
+	lpObj->AttackSuccessRate = lpBase->AttackSuccessRate;
 
-		lpObj->MagicSpeed = Dexterity / gServerInfo.m_DWMagicSpeedConstA;
-	}
-	if (lpObj->Class == CLASS_DK)
-	{
-		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_DKPhysiSpeedConstA;
+	lpObj->PhysiSpeed = lpBase->PhysiSpeed;
 
-		lpObj->MagicSpeed = Dexterity / gServerInfo.m_DKMagicSpeedConstA;
-	}
-	else if (lpObj->Class == CLASS_FE)
-	{
-		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_FEPhysiSpeedConstA;
-
-		lpObj->MagicSpeed = Dexterity / gServerInfo.m_FEMagicSpeedConstA;
-	}
-	else if (lpObj->Class == CLASS_MG)
-	{
-		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_MGPhysiSpeedConstA;
-
-		lpObj->MagicSpeed = Dexterity / gServerInfo.m_MGMagicSpeedConstA;
-	}
+	lpObj->MagicSpeed = lpBase->MagicSpeed;
 
 	lpObj->PhysiSpeed += lpObj->DrinkSpeed;
 
@@ -2242,22 +2655,7 @@ void CObjectManager::CharacterCalcAttribute(int aIndex)
 		lpObj->MagicSpeed += Amulet->m_AttackSpeed;
 	}
 
-	if (lpObj->Class == CLASS_DW)
-	{
-		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_DWDefenseSuccessRateConstA;
-	}
-	else if (lpObj->Class == CLASS_DK)
-	{
-		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_DKDefenseSuccessRateConstA;
-	}
-	else if (lpObj->Class == CLASS_FE)
-	{
-		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_FEDefenseSuccessRateConstA;
-	}
-	else if (lpObj->Class == CLASS_MG)
-	{
-		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_MGDefenseSuccessRateConstA;
-	}
+	lpObj->DefenseSuccessRate = lpBase->DefenseSuccessRate;
 
 	lpObj->DefenseSuccessRate += lpObj->Inventory[1].GetDefenseSuccessRate();
 
@@ -2348,22 +2746,7 @@ void CObjectManager::CharacterCalcAttribute(int aIndex)
 		lpObj->DefenseSuccessRate += (lpObj->DefenseSuccessRate * 10) / 100;
 	}
 
-	if (lpObj->Class == CLASS_DW)
-	{
-		lpObj->Defense = Dexterity / gServerInfo.m_DWDefenseConstA;
-	}
-	else if (lpObj->Class == CLASS_DK)
-	{
-		lpObj->Defense = Dexterity / gServerInfo.m_DKDefenseConstA;
-	}
-	else if (lpObj->Class == CLASS_FE)
-	{
-		lpObj->Defense = Dexterity / gServerInfo.m_FEDefenseConstA;
-	}
-	else if (lpObj->Class == CLASS_MG)
-	{
-		lpObj->Defense = Dexterity / gServerInfo.m_MGDefenseConstA;
-	}
+	lpObj->Defense = lpBase->Defense;
 
 	lpObj->Defense += lpObj->Inventory[1].GetDefense();
 
@@ -2455,17 +2838,9 @@ void CObjectManager::CharacterCalcAttribute(int aIndex)
 		}
 	}
 
-	lpObj->MaxLife = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].MaxLife;
-
-	lpObj->MaxMana = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].MaxMana;
+	lpObj->MaxLife = lpBase->MaxLife;
 
-	lpObj->MaxLife += gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].LevelLife * (lpObj->Level - 1);
-
-	lpObj->MaxMana += gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].LevelMana * (lpObj->Level - 1);
-
-	lpObj->MaxLife += ((lpObj->Vitality - gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].Vitality)) * lpObj->VitalityToLife;
-
-	lpObj->MaxMana += ((lpObj->Energy - gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].Energy)) * lpObj->EnergyToMana;
+	lpObj->MaxMana = lpBase->MaxMana;
 
 	if (Helper->IsItem() != 0 && Helper->m_IsValidItem != 0)
 	{
@@ -2572,19 +2947,19 @@ bool CObjectManager::CharacterInfoSet(BYTE* aRecv, int aIndex)
 		gMap[lpObj->Map].GetMapPos(lpObj->Map, &lpObj->X, &lpObj->Y);
 	}
 
-	if (lpObj->Level < 6 && lpObj->Class == CLASS_DW && gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) == 0 && lpObj->Map != MAP_LORENCIA)
+	if (lpObj->Level < 6 && lpObj->Class == CLASS_DW && gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) == 0 && lpObj->Map != MAP_LORENCIA)
 	{
 		result = gGate.GetGate(17, &gate, &map, &x, &y, &dir, &level);
 	}
-	else if (lpObj->Level < 6 && lpObj->Class == CLASS_DK && gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) == 0 && lpObj->Map != MAP_LORENCIA)
+	else if (lpObj->Level < 6 && lpObj->Class == CLASS_DK && gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) == 0 && lpObj->Map != MAP_LORENCIA)
 	{
 		result = gGate.GetGate(17, &gate, &map, &x, &y, &dir, &level);
 	}
-	else if (lpObj->Level < 6 && lpObj->Class == CLASS_FE && gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) == 0 && lpObj->Map != MAP_NORIA)
+	else if (lpObj->Level < 6 && lpObj->Class == CLASS_FE && gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) == 0 && lpObj->Map != MAP_NORIA)
 	{
 		result = gGate.GetGate(27, &gate, &map, &x, &y, &dir, &level);
 	}
-	else if (lpObj->Level < 6 && lpObj->Class == CLASS_MG && gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) == 0 && lpObj->Map != MAP_LORENCIA)
+	else if (lpObj->Level < 6 && lpObj->Class == CLASS_MG && gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) == 0 && lpObj->Map != MAP_LORENCIA)
 	{
 		result = gGate.GetGate(17, &gate, &map, &x, &y, &dir, &level);
 	}
@@ -2608,7 +2983,7 @@ bool CObjectManager::CharacterInfoSet(BYTE* aRecv, int aIndex)
 		lpObj->Dir = dir;
 	}
 
-	if (gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 4) != 0 || gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 8) != 0)
+	if (gMap[lpObj->Map].CheckWalkAttr(lpObj->X, lpObj->Y) == 0)
 	{
 		gMap[lpObj->Map].GetMapPos(lpObj->Map, &lpObj->X, &lpObj->Y);
 	}
@@ -2672,7 +3047,7 @@ bool CObjectManager::CharacterInfoSet(BYTE* aRecv, int aIndex)
 		lpObj->PKTime = 0;
 	}
 
-	memcpy(lpObj->Quest, lpMsg->Quest, sizeof(lpObj->Quest));
+	memcpy(lpObj->UserData->Quest, lpMsg->Quest, sizeof(lpObj->UserData->Quest));
 
 	gObjSetInventory1Pointer(lpObj);
 
@@ -2715,6 +3090,8 @@ bool CObjectManager::CharacterInfoSet(BYTE* aRecv, int aIndex)
 
 	this->CharacterMakePreviewCharSet(aIndex);
 
+	memset(lpObj->EffectMask, 0, sizeof(lpObj->EffectMask));
+
 	for (int n = 0; n < MAX_EFFECT_LIST; n++)
 	{
 		CEffect effect;
@@ -2748,6 +3125,8 @@ bool CObjectManager::CharacterInfoSet(BYTE* aRecv, int aIndex)
 
 	lpObj->Connected = OBJECT_ONLINE;
 
+	gObjNameIndexInsert(aIndex);
+
 	lpObj->TargetNumber = -1;
 
 	if (lpObj->Life == 0)
@@ -2759,6 +3138,8 @@ bool CObjectManager::CharacterInfoSet(BYTE* aRecv, int aIndex)
 		lpObj->DieRegen = 1;
 
 		lpObj->RegenTime = GetTickCount();
+
+		this->ObjectRegenSchedule(lpObj);
 	}
 
 	lpObj->Authority = 1;
@@ -2890,6 +3271,8 @@ void CObjectManager::CharacterLifeCheck(LPOBJ lpObj, LPOBJ lpTarget, int damage,
 
 		lpTarget->DieRegen = 1;
 
+		this->ObjectRegenSchedule(lpTarget);
+
 		lpTarget->PathCount = 0;
 
 		lpTarget->Teleport = ((lpTarget->Teleport == 1) ? 0 : lpTarget->Teleport);
@@ -1,7 +1,27 @@
 #pragma once
 
+#include "CriticalSection.h"
 #include "User.h"
 
+struct OBJECT_MSG_INFO
+{
+	DWORD Deadline;
+	DWORD Serial;
+	DWORD Generation;
+	int Index;
+	int MsgCode;
+	int SendUser;
+	int SubCode;
+	int SubCode2;
+};
+
+struct OBJECT_REGEN_INFO
+{
+	DWORD Deadline;
+	DWORD RegenTime;
+	int Index;
+};
+
 class CObjectManager
 {
 public:
@@ -10,12 +30,24 @@ public:
 
 	virtual ~CObjectManager();
 
-	void ObjectMsgProc(LPOBJ lpObj);
+	void ObjectMsgSchedule(int aIndex, int MsgCode, int SendUser, int MsgTimeDelay, int SubCode);
+
+	void ObjectAttackMsgSchedule(int aIndex, int MsgCode, int SendUser, int MsgTimeDelay, int SubCode, int SubCode2);
+
+	void ObjectMsgClear(int aIndex);
+
+	void ObjectMsgProc();
+
+	void ObjectAttackMsgProc();
 
 	void ObjectSetStateCreate(int aIndex);
 
 	void ObjectSetStateProc();
 
+	void ObjectRegenSchedule(LPOBJ lpObj);
+
+	void ObjectRegenProc();
+
 	void ObjectStateProc(LPOBJ lpObj, int MessageCode, int aIndex, int SubCode);
 
 	void ObjectStateAttackProc(LPOBJ lpObj, int MessageCode, int aIndex, int SubCode1, int SubCode2);
@@ -24,6 +56,10 @@ public:
 
 	void ObjectMonsterAndMsgProc();
 
+	void ObjectActiveRegionProc();
+
+	bool ObjectCheckIdle(LPOBJ lpObj);
+
 	bool CharacterGameClose(int aIndex);
 
 	void CharacterGameCloseSet(int aIndex, int type);
@@ -64,11 +100,41 @@ public:
 
 	void CharacterCalcBP(LPOBJ lpObj);
 
+	void CharacterCalcAttributeReset();
+
+	void CharacterCalcAttributeClear(LPOBJ lpObj);
+
+	void CharacterCalcAttributeCheck(LPOBJ lpObj);
+
+	CHARACTER_CALC_BASE* CharacterCalcBaseLayer(LPOBJ lpObj, bool bow);
+
+	void CharacterCalcItemLayer(LPOBJ lpObj);
+
 	void CharacterCalcAttribute(int aIndex);
 
 	bool CharacterInfoSet(BYTE* aRecv, int aIndex);
 
 	void CharacterLifeCheck(LPOBJ lpObj, LPOBJ lpTarget, int damage, int DamageType, int flag, int type, int skill);
+
+private:
+
+	DWORD m_IdleTickCount;
+
+	std::vector<OBJECT_REGEN_INFO> m_RegenHeap;
+
+	CCriticalSection m_RegenCritical;
+
+	std::vector<OBJECT_MSG_INFO> m_MsgHeap;
+
+	std::vector<OBJECT_MSG_INFO> m_AttackMsgHeap;
+
+	DWORD m_MsgSerial;
+
+	DWORD m_MsgGeneration[MAX_OBJECT];
+
+	CCriticalSection m_MsgCritical;
+
+	int m_CalcAttributeSerial;
 };
 
 extern CObjectManager gObjectManager;
\ No newline at end of file
@@ -589,6 +589,8 @@ void CParty::GCPartyListSend(int index)
 		return;
 	}
 
+	this->m_PartyInfo[index].LifeCount = -1;
+
 	BYTE send[256];
 
 	PMSG_PARTY_LIST_SEND pMsg;
@@ -692,6 +694,19 @@ void CParty::GCPartyLifeSend(int index)
 		pMsg.count++;
 	}
 
+	PARTY_INFO* lpInfo = &this->m_PartyInfo[index];
+
+	if (pMsg.count == lpInfo->LifeCount && memcmp(&send[sizeof(pMsg)], lpInfo->Life, pMsg.count) == 0 && (--lpInfo->LifeResync) > 0)
+	{
+		return;
+	}
+
+	memcpy(lpInfo->Life, &send[sizeof(pMsg)], pMsg.count);
+
+	lpInfo->LifeCount = pMsg.count;
+
+	lpInfo->LifeResync = PARTY_LIFE_RESYNC_TIME;
+
 	pMsg.header.size = size;
 
 	memcpy(send, &pMsg, sizeof(pMsg));
@@ -5,6 +5,7 @@
 
 #define MAX_PARTY_USER 5
 #define MAX_PARTY_DISTANCE 10
+#define PARTY_LIFE_RESYNC_TIME 10
 
 //**********************************************//
 //************ Client -> GameServer ************//
@@ -82,6 +83,9 @@ struct PARTY_INFO
 {
 	int Count;
 	int Index[MAX_PARTY_USER];
+	BYTE Life[MAX_PARTY_USER];
+	int LifeCount;
+	int LifeResync;
 };
 
 class CParty
@@ -1090,7 +1090,7 @@ void CGMoveRecv(PMSG_MOVE_RECV* lpMsg, int aIndex)
 		return;
 	}
 
-	if (lpObj->PathCount > 0 && (gMap[lpObj->Map].CheckAttr(lpObj->TX, lpObj->TY, 4) != 0 || gMap[lpObj->Map].CheckAttr(lpObj->TX, lpObj->TY, 8) != 0))
+	if (lpObj->PathCount > 0 && (gMap[lpObj->Map].CheckWalkAttr(lpObj->TX, lpObj->TY) == 0))
 	{
 		lpObj->PathCur = 0;
 
@@ -2291,6 +2291,17 @@ void GCHealthBarSend(int aIndex)
 		pMsg.count++;
 	}
 
+	if (lpObj->UserData->HealthBarCount == pMsg.count && memcmp(lpObj->UserData->HealthBarData, &send[sizeof(pMsg)], (size - sizeof(pMsg))) == 0 && (--lpObj->UserData->HealthBarResync) > 0)
+	{
+		return;
+	}
+
+	lpObj->UserData->HealthBarCount = pMsg.count;
+
+	memcpy(lpObj->UserData->HealthBarData, &send[sizeof(pMsg)], (size - sizeof(pMsg)));
+
+	lpObj->UserData->HealthBarResync = HEALTH_BAR_RESYNC_TIME;
+
 	pMsg.header.size[0] = SET_NUMBERHB(size);
 
 	pMsg.header.size[1] = SET_NUMBERLB(size);
@@ -143,7 +143,7 @@ bool CQuest::AddQuestList(LPOBJ lpObj, int QuestIndex, int QuestState)
 		return 0;
 	}
 
-	lpObj->Quest[QuestIndex / 4] = (lpObj->Quest[QuestIndex / 4] & gQuestBitMask[(QuestIndex % 4) * 2]) | ((QuestState & 3) << ((QuestIndex % 4) * 2));
+	lpObj->UserData->Quest[QuestIndex / 4] = (lpObj->UserData->Quest[QuestIndex / 4] & gQuestBitMask[(QuestIndex % 4) * 2]) | ((QuestState & 3) << ((QuestIndex % 4) * 2));
 
 	return 1;
 }
@@ -155,7 +155,7 @@ BYTE CQuest::GetQuestList(LPOBJ lpObj, int QuestIndex)
 		return 0;
 	}
 
-	return lpObj->Quest[QuestIndex / 4];
+	return lpObj->UserData->Quest[QuestIndex / 4];
 }
 
 BYTE CQuest::GetQuestState(LPOBJ lpObj, int QuestIndex)
@@ -165,7 +165,7 @@ BYTE CQuest::GetQuestState(LPOBJ lpObj, int QuestIndex)
 		return 0;
 	}
 
-	return (lpObj->Quest[QuestIndex / 4] >> ((QuestIndex % 4) * 2)) & 3;
+	return (lpObj->UserData->Quest[QuestIndex / 4] >> ((QuestIndex % 4) * 2)) & 3;
 }
 
 bool CQuest::CheckQuestRequisite(LPOBJ lpObj, QUEST_INFO* lpInfo)
@@ -205,7 +205,7 @@ bool CQuest::CheckQuestListState(LPOBJ lpObj, int QuestIndex, int QuestState)
 		return 0;
 	}
 
-	if (((lpObj->Quest[QuestIndex / 4] >> ((QuestIndex % 4) * 2)) & 3) == QuestState)
+	if (((lpObj->UserData->Quest[QuestIndex / 4] >> ((QuestIndex % 4) * 2)) & 3) == QuestState)
 	{
 		return 1;
 	}
@@ -367,7 +367,7 @@ void CQuest::GCQuestInfoSend(int aIndex)
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
-	if (lpObj->SendQuestInfo != 0)
+	if (lpObj->UserData->SendQuestInfo != 0)
 	{
 		return;
 	}
@@ -378,11 +378,11 @@ void CQuest::GCQuestInfoSend(int aIndex)
 
 	pMsg.count = MAX_QUEST_LIST / 4;
 
-	memcpy(pMsg.QuestInfo, lpObj->Quest, sizeof(pMsg.QuestInfo));
+	memcpy(pMsg.QuestInfo, lpObj->UserData->Quest, sizeof(pMsg.QuestInfo));
 
 	DataSend(aIndex, (BYTE*)&pMsg, pMsg.header.size);
 
-	lpObj->SendQuestInfo = 1;
+	lpObj->UserData->SendQuestInfo = 1;
 }
 
 void CQuest::GCQuestStateSend(int aIndex, int QuestIndex)
@@ -47,17 +47,17 @@ void CReconnect::SetReconnectInfo(LPOBJ lpObj)
 
 	info.PartyNumber = lpObj->PartyNumber;
 
-	info.AutoAddPointCount = lpObj->AutoAddPointCount;
+	info.AutoAddPointCount = lpObj->UserData->AutoAddPointCount;
 
-	memcpy(info.AutoAddPointStats, lpObj->AutoAddPointStats, sizeof(info.AutoAddPointStats));
+	memcpy(info.AutoAddPointStats, lpObj->UserData->AutoAddPointStats, sizeof(info.AutoAddPointStats));
 
-	info.AutoResetEnable = lpObj->AutoResetEnable;
+	info.AutoResetEnable = lpObj->UserData->AutoResetEnable;
 
-	memcpy(info.AutoResetStats, lpObj->AutoResetStats, sizeof(info.AutoResetStats));
+	memcpy(info.AutoResetStats, lpObj->UserData->AutoResetStats, sizeof(info.AutoResetStats));
 
 	info.RequestOption = lpObj->Option;
 
-	memcpy(info.AutoPartyPassword, lpObj->AutoPartyPassword, sizeof(info.AutoPartyPassword));
+	memcpy(info.AutoPartyPassword, lpObj->UserData->AutoPartyPassword, sizeof(info.AutoPartyPassword));
 
 	std::map<std::string, RECONNECT_INFO>::iterator it = this->m_ReconnectInfo.find(std::string(lpObj->Name));
 
@@ -134,15 +134,15 @@ void CReconnect::ResumeParty(LPOBJ lpObj, RECONNECT_INFO* lpInfo)
 
 void CReconnect::ResumeCommand(LPOBJ lpObj, RECONNECT_INFO* lpInfo)
 {
-	lpObj->AutoAddPointCount = lpInfo->AutoAddPointCount;
+	lpObj->UserData->AutoAddPointCount = lpInfo->AutoAddPointCount;
 
-	memcpy(lpObj->AutoAddPointStats, lpInfo->AutoAddPointStats, sizeof(lpObj->AutoAddPointStats));
+	memcpy(lpObj->UserData->AutoAddPointStats, lpInfo->AutoAddPointStats, sizeof(lpObj->UserData->AutoAddPointStats));
 
-	lpObj->AutoResetEnable = lpInfo->AutoResetEnable;
+	lpObj->UserData->AutoResetEnable = lpInfo->AutoResetEnable;
 
-	memcpy(lpObj->AutoResetStats, lpInfo->AutoResetStats, sizeof(lpObj->AutoResetStats));
+	memcpy(lpObj->UserData->AutoResetStats, lpInfo->AutoResetStats, sizeof(lpObj->UserData->AutoResetStats));
 
 	lpObj->Option = lpInfo->RequestOption;
 
-	memcpy(lpObj->AutoPartyPassword, lpInfo->AutoPartyPassword, sizeof(lpObj->AutoPartyPassword));
+	memcpy(lpObj->UserData->AutoPartyPassword, lpInfo->AutoPartyPassword, sizeof(lpObj->UserData->AutoPartyPassword));
 }
\ No newline at end of file
@@ -34,6 +34,7 @@
 #include "MonsterSetBase.h"
 #include "Move.h"
 #include "Notice.h"
+#include "ObjectManager.h"
 #include "PacketManager.h"
 #include "Path.h"
 #include "Quest.h"
@@ -156,6 +157,8 @@ void CServerInfo::ReadCharacterInfo()
 
 	gDefaultClassInfo.Load(gPath.GetFullPath("Character\\DefaultClassInfo.txt"));
 
+	gObjectManager.CharacterCalcAttributeReset();
+
 	LogAdd(LOG_BLUE, "[ServerInfo] Character loaded successfully");
 }
 
@@ -257,6 +260,8 @@ void CServerInfo::ReadItemInfo()
 
 	gCustomWing.Load(gPath.GetFullPath("Item\\CustomWing.txt"));
 
+	gObjectManager.CharacterCalcAttributeReset();
+
 	for (int n = OBJECT_START_USER; n < MAX_OBJECT; n++)
 	{
 		if (gObjIsConnectedGP(n) != 0)
@@ -375,8 +380,6 @@ void CServerInfo::ReloadMonsterInfo()
 		gObjDel(n);
 	}
 
-	gObjMonCount = 0;
-
 	this->ReadMonsterInfo();
 
 	gMonsterManager.SetMonsterData();
@@ -1308,6 +1311,16 @@ void CServerInfo::ReadCommonInfo(const char* section, const char* path)
 
 	this->m_MonsterHealthBarSwitch = GetPrivateProfileInt(section, "MonsterHealthBarSwitch", 0, path);
 
+	this->m_MonsterIdleSwitch = GetPrivateProfileInt(section, "MonsterIdleSwitch", 0, path);
+
+	this->m_MonsterIdleTickRate = GetPrivateProfileInt(section, "MonsterIdleTickRate", 0, path);
+
+	this->m_MonsterPathNodeBudget = GetPrivateProfileInt(section, "MonsterPathNodeBudget", 0, path);
+
+	this->m_MonsterFlowFieldSwitch = GetPrivateProfileInt(section, "MonsterFlowFieldSwitch", 0, path);
+
+	this->m_MapWallCacheSwitch = GetPrivateProfileInt(section, "MapWallCacheSwitch", 0, path);
+
 	this->m_NonPK = GetPrivateProfileInt(section, "NonPK", 0, path);
 
 	this->m_PKLimitFree = GetPrivateProfileInt(section, "PKLimitFree", 0, path);
@@ -106,6 +106,11 @@ public:
 	int m_PersonalCodeCheck;
 	int m_MonsterLifeRate;
 	int m_MonsterHealthBarSwitch;
+	int m_MonsterIdleSwitch;
+	int m_MonsterIdleTickRate;
+	int m_MonsterPathNodeBudget;
+	int m_MonsterFlowFieldSwitch;
+	int m_MapWallCacheSwitch;
 	int m_NonPK;
 	int m_PKLimitFree;
 	int m_PKDownTime1;
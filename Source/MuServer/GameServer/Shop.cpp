@@ -22,6 +22,8 @@ void CShop::Init()
 
 		this->m_InventoryMap[n] = -1;
 	}
+
+	this->MakeItemListPacket();
 }
 
 void CShop::Load(const char* path)
@@ -94,6 +96,8 @@ void CShop::Load(const char* path)
 		ErrorMessageBox(lpReadScript->GetError());
 	}
 
+	this->MakeItemListPacket();
+
 	delete lpReadScript;
 }
 
@@ -104,9 +108,9 @@ void CShop::ShopItemSet(int slot, BYTE type)
 		return;
 	}
 
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(this->m_Item[slot].m_Index);
 
-	if (gItemManager.GetInfo(this->m_Item[slot].m_Index, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
@@ -115,14 +119,14 @@ void CShop::ShopItemSet(int slot, BYTE type)
 
 	int y = slot / 8;
 
-	if ((x + ItemInfo.Width) > 8 || (y + ItemInfo.Height) > 15)
+	if ((x + lpItemInfo->Width) > 8 || (y + lpItemInfo->Height) > 15)
 	{
 		return;
 	}
 
-	for (int sy = 0; sy < ItemInfo.Height; sy++)
+	for (int sy = 0; sy < lpItemInfo->Height; sy++)
 	{
-		for (int sx = 0; sx < ItemInfo.Width; sx++)
+		for (int sx = 0; sx < lpItemInfo->Width; sx++)
 		{
 			this->m_InventoryMap[(((sy + y) * 8) + (sx + x))] = type;
 		}
@@ -152,9 +156,9 @@ BYTE CShop::ShopRectCheck(int x, int y, int width, int height)
 
 void CShop::InsertItem(int ItemIndex, int ItemLevel, int ItemDurability, int ItemSkillOption, int ItemLuckOption, int ItemAddOption, int ItemExceOption)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(ItemIndex);
 
-	if (gItemManager.GetInfo(ItemIndex, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
@@ -165,7 +169,7 @@ void CShop::InsertItem(int ItemIndex, int ItemLevel, int ItemDurability, int Ite
 		{
 			if (this->m_InventoryMap[((y * 8) + x)] == 0xFF)
 			{
-				BYTE slot = this->ShopRectCheck(x, y, ItemInfo.Width, ItemInfo.Height);
+				BYTE slot = this->ShopRectCheck(x, y, lpItemInfo->Width, lpItemInfo->Height);
 
 				if (slot != 0xFF)
 				{
@@ -186,16 +190,16 @@ void CShop::InsertItem(int ItemIndex, int ItemLevel, int ItemDurability, int Ite
 
 void CShop::InsertItem(int ItemIndex, int ItemLevel, int ItemDurability, int ItemSkillOption, int ItemLuckOption, int ItemAddOption, int ItemExceOption, int ItemSlotX, int ItemSlotY)
 {
-	ITEM_INFO ItemInfo;
+	ITEM_INFO* lpItemInfo = gItemManager.GetInfo(ItemIndex);
 
-	if (gItemManager.GetInfo(ItemIndex, &ItemInfo) == 0)
+	if (lpItemInfo == 0)
 	{
 		return;
 	}
 
 	if (this->m_InventoryMap[((ItemSlotY * 8) + ItemSlotX)] == 0xFF)
 	{
-		BYTE slot = this->ShopRectCheck(ItemSlotX, ItemSlotY, ItemInfo.Width, ItemInfo.Height);
+		BYTE slot = this->ShopRectCheck(ItemSlotX, ItemSlotY, lpItemInfo->Width, lpItemInfo->Height);
 
 		if (slot != 0xFF)
 		{
@@ -244,8 +248,13 @@ long CShop::GetItemCount()
 
 bool CShop::GCShopItemListSend(int aIndex)
 {
-	BYTE send[2048];
+	DataSend(aIndex, this->m_ItemListSend, this->m_ItemListSize);
+
+	return 1;
+}
 
+void CShop::MakeItemListPacket()
+{
 	PMSG_SHOP_ITEM_LIST_SEND pMsg;
 
 	pMsg.header.set(0x31, 0);
@@ -264,9 +273,9 @@ bool CShop::GCShopItemListSend(int aIndex)
 		{
 			info.slot = n;
 
-			gItemManager.ItemByteConvert(info.ItemInfo, this->m_Item[n]);
+			gItemManager.ItemByteConvert(info.ItemInfo, &this->m_Item[n]);
 
-			memcpy(&send[size], &info, sizeof(info));
+			memcpy(&this->m_ItemListSend[size], &info, sizeof(info));
 
 			size += sizeof(info);
 
@@ -278,9 +287,7 @@ bool CShop::GCShopItemListSend(int aIndex)
 
 	pMsg.header.size[1] = SET_NUMBERLB(size);
 
-	memcpy(send, &pMsg, sizeof(pMsg));
+	memcpy(this->m_ItemListSend, &pMsg, sizeof(pMsg));
 
-	DataSend(aIndex, send, size);
-
-	return 1;
+	this->m_ItemListSize = size;
 }
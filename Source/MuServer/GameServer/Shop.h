@@ -55,9 +55,17 @@ public:
 
 	bool GCShopItemListSend(int aIndex);
 
+private:
+
+	void MakeItemListPacket();
+
 private:
 
 	CItem m_Item[SHOP_SIZE];
 
 	BYTE m_InventoryMap[SHOP_SIZE];
+
+	BYTE m_ItemListSend[sizeof(PMSG_SHOP_ITEM_LIST_SEND) + (SHOP_SIZE * sizeof(PMSG_SHOP_ITEM_LIST))];
+
+	int m_ItemListSize;
 };
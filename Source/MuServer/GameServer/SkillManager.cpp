@@ -24,7 +24,10 @@ CSkillManager gSkillManager;
 
 CSkillManager::CSkillManager()
 {
-	this->m_SkillInfo.clear();
+	for (int n = 0; n < MAX_SKILL; n++)
+	{
+		this->m_SkillInfo[n].Index = -1;
+	}
 }
 
 CSkillManager::~CSkillManager()
@@ -52,7 +55,10 @@ void CSkillManager::Load(const char* path)
 		return;
 	}
 
-	this->m_SkillInfo.clear();
+	for (int n = 0; n < MAX_SKILL; n++)
+	{
+		this->m_SkillInfo[n].Index = -1;
+	}
 
 	try
 	{
@@ -98,7 +104,17 @@ void CSkillManager::Load(const char* path)
 				info.RequireClass[n] = lpReadScript->GetAsNumber();
 			}
 
-			this->m_SkillInfo.insert(std::pair<int, SKILL_INFO>(info.Index, info));
+			if (info.Index < 0 || info.Index >= MAX_SKILL)
+			{
+				LogAdd(LOG_RED, "[SkillManager] Skill index %d out of range (0-%d)", info.Index, (MAX_SKILL - 1));
+
+				continue;
+			}
+
+			if (this->m_SkillInfo[info.Index].Index == -1)
+			{
+				this->m_SkillInfo[info.Index] = info;
+			}
 		}
 	}
 	catch (...)
@@ -109,90 +125,79 @@ void CSkillManager::Load(const char* path)
 	delete lpReadScript;
 }
 
-bool CSkillManager::GetInfo(int index, SKILL_INFO* lpInfo)
+SKILL_INFO* CSkillManager::GetInfo(int index)
 {
-	std::map<int, SKILL_INFO>::iterator it = this->m_SkillInfo.find(index);
-
-	if (it == this->m_SkillInfo.end())
+	if (index < 0 || index >= MAX_SKILL)
 	{
-		return false;
+		return 0;
 	}
-	else
-	{
-		(*lpInfo) = it->second;
 
-		return true;
+	if (this->m_SkillInfo[index].Index != index)
+	{
+		return 0;
 	}
+
+	return &this->m_SkillInfo[index];
 }
 
 int CSkillManager::GetSkillDamage(int index)
 {
-	std::map<int, SKILL_INFO>::iterator it = this->m_SkillInfo.find(index);
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (it == this->m_SkillInfo.end())
+	if (lpSkillInfo == 0)
 	{
 		return -1;
 	}
-	else
-	{
-		return it->second.Damage;
-	}
+
+	return lpSkillInfo->Damage;
 }
 
 int CSkillManager::GetSkillMana(int index)
 {
-	std::map<int, SKILL_INFO>::iterator it = this->m_SkillInfo.find(index);
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (it == this->m_SkillInfo.end())
+	if (lpSkillInfo == 0)
 	{
 		return -1;
 	}
-	else
-	{
-		return it->second.Mana;
-	}
+
+	return lpSkillInfo->Mana;
 }
 
 int CSkillManager::GetSkillBP(int index)
 {
-	std::map<int, SKILL_INFO>::iterator it = this->m_SkillInfo.find(index);
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (it == this->m_SkillInfo.end())
+	if (lpSkillInfo == 0)
 	{
 		return -1;
 	}
-	else
-	{
-		return it->second.BP;
-	}
+
+	return lpSkillInfo->BP;
 }
 
 int CSkillManager::GetSkillType(int index)
 {
-	std::map<int, SKILL_INFO>::iterator it = this->m_SkillInfo.find(index);
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (it == this->m_SkillInfo.end())
+	if (lpSkillInfo == 0)
 	{
 		return -1;
 	}
-	else
-	{
-		return it->second.Type;
-	}
+
+	return lpSkillInfo->Type;
 }
 
 int CSkillManager::GetSkillEffect(int index)
 {
-	std::map<int, SKILL_INFO>::iterator it = this->m_SkillInfo.find(index);
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (it == this->m_SkillInfo.end())
+	if (lpSkillInfo == 0)
 	{
 		return -1;
 	}
-	else
-	{
-		return it->second.Effect;
-	}
+
+	return lpSkillInfo->Effect;
 }
 
 int CSkillManager::GetSkillAngle(int x, int y, int tx, int ty)
@@ -317,14 +322,14 @@ int CSkillManager::GetSkillNumber(int index, int level)
 
 bool CSkillManager::CheckSkillMana(LPOBJ lpObj, int index)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
-	if (lpObj->Mana < ((SkillInfo.Mana * lpObj->MPConsumptionRate) / 100))
+	if (lpObj->Mana < ((lpSkillInfo->Mana * lpObj->MPConsumptionRate) / 100))
 	{
 		return false;
 	}
@@ -336,14 +341,14 @@ bool CSkillManager::CheckSkillMana(LPOBJ lpObj, int index)
 
 bool CSkillManager::CheckSkillBP(LPOBJ lpObj, int index)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
-	if (lpObj->BP < ((SkillInfo.BP * lpObj->BPConsumptionRate) / 100))
+	if (lpObj->BP < ((lpSkillInfo->BP * lpObj->BPConsumptionRate) / 100))
 	{
 		return false;
 	}
@@ -355,19 +360,19 @@ bool CSkillManager::CheckSkillBP(LPOBJ lpObj, int index)
 
 bool CSkillManager::CheckSkillRange(int index, int x, int y, int tx, int ty)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
-	if (SkillInfo.Range == 0)
+	if (lpSkillInfo->Range == 0)
 	{
 		return false;
 	}
 
-	if ((int)sqrt(pow((float)(x - tx), 2) + pow((float)(y - ty), 2)) <= SkillInfo.Range)
+	if ((int)sqrt(pow((float)(x - tx), 2) + pow((float)(y - ty), 2)) <= lpSkillInfo->Range)
 	{
 		return true;
 	}
@@ -379,19 +384,19 @@ bool CSkillManager::CheckSkillRange(int index, int x, int y, int tx, int ty)
 
 bool CSkillManager::CheckSkillRadio(int index, int x, int y, int tx, int ty)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
-	if (SkillInfo.Radio == 0)
+	if (lpSkillInfo->Radio == 0)
 	{
 		return false;
 	}
 
-	if ((int)sqrt(pow((float)(x - tx), 2) + pow((float)(y - ty), 2)) <= SkillInfo.Radio)
+	if ((int)sqrt(pow((float)(x - tx), 2) + pow((float)(y - ty), 2)) <= lpSkillInfo->Radio)
 	{
 		return true;
 	}
@@ -416,14 +421,14 @@ bool CSkillManager::CheckSkillFrustrum(int* SkillFrustrumX, int* SkillFrustrumY,
 
 bool CSkillManager::CheckSkillDelay(LPOBJ lpObj, int index)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
-	if ((GetTickCount() - lpObj->SkillDelay[index]) < ((DWORD)SkillInfo.Delay))
+	if ((GetTickCount() - lpObj->SkillDelay[index]) < ((DWORD)lpSkillInfo->Delay))
 	{
 		return false;
 	}
@@ -489,14 +494,14 @@ bool CSkillManager::CheckSkillTarget(LPOBJ lpObj, int aIndex, int bIndex, int ty
 
 bool CSkillManager::CheckSkillRequireLevel(LPOBJ lpObj, int index)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
-	if (lpObj->Level >= SkillInfo.RequireLevel)
+	if (lpObj->Level >= lpSkillInfo->RequireLevel)
 	{
 		return true;
 	}
@@ -508,14 +513,14 @@ bool CSkillManager::CheckSkillRequireLevel(LPOBJ lpObj, int index)
 
 bool CSkillManager::CheckSkillRequireEnergy(LPOBJ lpObj, int index)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
-	if ((lpObj->Energy) >= SkillInfo.RequireEnergy)
+	if ((lpObj->Energy) >= lpSkillInfo->RequireEnergy)
 	{
 		return true;
 	}
@@ -527,9 +532,9 @@ bool CSkillManager::CheckSkillRequireEnergy(LPOBJ lpObj, int index)
 
 bool CSkillManager::CheckSkillRequireClass(LPOBJ lpObj, int index)
 {
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(index);
 
-	if (!this->GetInfo(index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
@@ -539,12 +544,12 @@ bool CSkillManager::CheckSkillRequireClass(LPOBJ lpObj, int index)
 		return false;
 	}
 
-	if (SkillInfo.RequireClass[lpObj->Class] == 0)
+	if (lpSkillInfo->RequireClass[lpObj->Class] == 0)
 	{
 		return false;
 	}
 
-	if ((lpObj->ChangeUp + 1) >= SkillInfo.RequireClass[lpObj->Class])
+	if ((lpObj->ChangeUp + 1) >= lpSkillInfo->RequireClass[lpObj->Class])
 	{
 		return true;
 	}
@@ -1186,16 +1191,16 @@ bool CSkillManager::SkillTripleShot(int aIndex, int bIndex, CSkill* lpSkill, BYT
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(lpSkill->m_index);
 
-	if (!this->GetInfo(lpSkill->m_index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
 	int SkillFrustrumX[4], SkillFrustrumY[4];
 
-	this->GetSkillFrustrum(SkillFrustrumX, SkillFrustrumY, angle, lpObj->X, lpObj->Y, (float)SkillInfo.Radio, (float)SkillInfo.Range);
+	this->GetSkillFrustrum(SkillFrustrumX, SkillFrustrumY, angle, lpObj->X, lpObj->Y, (float)lpSkillInfo->Radio, (float)lpSkillInfo->Range);
 
 	int count = 0;
 
@@ -1734,16 +1739,16 @@ bool CSkillManager::SkillPowerSlash(int aIndex, int bIndex, CSkill* lpSkill, BYT
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
-	SKILL_INFO SkillInfo;
+	SKILL_INFO* lpSkillInfo = this->GetInfo(lpSkill->m_index);
 
-	if (!this->GetInfo(lpSkill->m_index, &SkillInfo))
+	if (lpSkillInfo == 0)
 	{
 		return false;
 	}
 
 	int SkillFrustrumX[4], SkillFrustrumY[4];
 
-	this->GetSkillFrustrum(SkillFrustrumX, SkillFrustrumY, angle, lpObj->X, lpObj->Y, (float)SkillInfo.Radio, (float)SkillInfo.Range);
+	this->GetSkillFrustrum(SkillFrustrumX, SkillFrustrumY, angle, lpObj->X, lpObj->Y, (float)lpSkillInfo->Radio, (float)lpSkillInfo->Range);
 
 	int count = 0;
 
@@ -1807,7 +1812,7 @@ void CSkillManager::CGMultiSkillAttackRecv(PMSG_MULTI_SKILL_ATTACK_RECV* lpMsg,
 		return;
 	}
 
-	if (gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) != 0)
+	if (gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) != 0)
 	{
 		return;
 	}
@@ -1941,7 +1946,7 @@ void CSkillManager::CGSkillAttackRecv(PMSG_SKILL_ATTACK_RECV* lpMsg, int aIndex)
 	{
 		//Enable buff skills in event maps
 	}
-	else if (gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) != 0 || gMap[lpTarget->Map].CheckAttr(lpTarget->X, lpTarget->Y, 1) != 0)
+	else if (gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) != 0 || gMap[lpTarget->Map].CheckSafeAttr(lpTarget->X, lpTarget->Y) != 0)
 	{
 		return;
 	}
@@ -2000,7 +2005,7 @@ void CSkillManager::CGDurationSkillAttackRecv(PMSG_DURATION_SKILL_ATTACK_RECV* l
 		return;
 	}
 
-	if (gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) != 0)
+	if (gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) != 0)
 	{
 		return;
 	}
@@ -196,7 +196,7 @@ public:
 
 	void Load(const char* path);
 
-	bool GetInfo(int index, SKILL_INFO* lpInfo);
+	SKILL_INFO* GetInfo(int index);
 
 	int GetSkillDamage(int index);
 
@@ -318,7 +318,7 @@ public:
 
 private:
 
-	std::map<int, SKILL_INFO> m_SkillInfo;
+	SKILL_INFO m_SkillInfo[MAX_SKILL];
 };
 
 extern CSkillManager gSkillManager;
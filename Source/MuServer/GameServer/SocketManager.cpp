@@ -3,6 +3,7 @@
 #include "HackCheck.h"
 #include "IpManager.h"
 #include "Log.h"
+#include "MemoryAllocator.h"
 #include "PacketManager.h"
 #include "Protocol.h"
 #include "SerialCheck.h"
@@ -530,7 +531,7 @@ bool CSocketManager::DataSend(int index, BYTE* lpMsg, int size)
 
 	if (lpIoContext->IoSize > 0)
 	{
-		if ((lpIoContext->IoSideBuffer.size + size) > MAX_SIDE_PACKET_SIZE)
+		if (gMemoryAllocator.GrowSocketContext(gObj[index].PerSocketContext, (lpIoContext->IoSideBuffer.size + size)) == 0)
 		{
 			gLog.Output(LOG_CONNECT, "[SocketManager] Max msg size (Type: 2, Index: %d, Size: %d)", index, (lpIoContext->IoSideBuffer.size + size));
 
@@ -621,6 +622,10 @@ void CSocketManager::Disconnect(int index)
 
 	gObjDel(index);
 
+	gMemoryAllocator.FreeSocketContext(gObj[index].PerSocketContext);
+
+	gObj[index].PerSocketContext = 0;
+
 	this->m_critical.unlock();
 }
 
@@ -635,6 +640,15 @@ void CSocketManager::OnRecv(int index, DWORD IoSize, IO_RECV_CONTEXT* lpIoContex
 		return;
 	}
 
+	if (gObj[index].Socket == INVALID_SOCKET || gObj[index].Connected == OBJECT_OFFLINE || gObj[index].PerSocketContext == 0)
+	{
+		this->m_critical.unlock();
+
+		return;
+	}
+
+	lpIoContext = &gObj[index].PerSocketContext->IoRecvContext;
+
 	if (IoSize == 0)
 	{
 		this->Disconnect(index);
@@ -699,6 +713,15 @@ void CSocketManager::OnSend(int index, DWORD IoSize, IO_SEND_CONTEXT* lpIoContex
 		return;
 	}
 
+	if (gObj[index].Socket == INVALID_SOCKET || gObj[index].Connected == OBJECT_OFFLINE || gObj[index].PerSocketContext == 0)
+	{
+		this->m_critical.unlock();
+
+		return;
+	}
+
+	lpIoContext = &gObj[index].PerSocketContext->IoSendContext;
+
 	if (IoSize == 0)
 	{
 		this->Disconnect(index);
@@ -876,6 +899,8 @@ DWORD WINAPI CSocketManager::ServerAcceptThread(CSocketManager* lpSocketManager)
 
 		LPOBJ lpObj = &gObj[index];
 
+		lpObj->PerSocketContext = gMemoryAllocator.AllocSocketContext();
+
 		lpObj->PerSocketContext->Socket = socket;
 
 		lpObj->PerSocketContext->Index = index;
@@ -963,23 +988,24 @@ DWORD WINAPI CSocketManager::ServerWorkerThread(CSocketManager* lpSocketManager)
 			return 0;
 		}
 
-		IO_CONTEXT* lpIoContext = (IO_CONTEXT*)lpOverlapped;
+		// A completion can arrive after Disconnect returned the context to the
+		// pool, so the overlapped is only matched against the context the
+		// user owns now and never dereferenced.
 
-		switch (lpIoContext->IoType)
+		if (OBJECT_USER_RANGE(index) == 0 || gObj[index].Socket == INVALID_SOCKET || gObj[index].Connected == OBJECT_OFFLINE || gObj[index].PerSocketContext == 0)
 		{
-			case IO_RECV:
-			{
-				lpSocketManager->OnRecv(index, IoSize, (IO_RECV_CONTEXT*)lpIoContext);
-
-				break;
-			}
+			lpSocketManager->m_critical.unlock();
 
-			case IO_SEND:
-			{
-				lpSocketManager->OnSend(index, IoSize, (IO_SEND_CONTEXT*)lpIoContext);
+			continue;
+		}
 
-				break;
-			}
+		if (lpOverlapped == &gObj[index].PerSocketContext->IoRecvContext.overlapped)
+		{
+			lpSocketManager->OnRecv(index, IoSize, &gObj[index].PerSocketContext->IoRecvContext);
+		}
+		else if (lpOverlapped == &gObj[index].PerSocketContext->IoSendContext.overlapped)
+		{
+			lpSocketManager->OnSend(index, IoSize, &gObj[index].PerSocketContext->IoSendContext);
 		}
 
 		lpSocketManager->m_critical.unlock();
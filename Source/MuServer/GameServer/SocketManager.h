@@ -10,6 +10,7 @@
 
 #define MAX_MAIN_PACKET_SIZE 8192
 #define MAX_SIDE_PACKET_SIZE 16384
+#define MIN_SIDE_PACKET_SIZE 2048
 #define MAX_SERVER_WORKER_THREAD 8
 #define MAX_IO_OPERATION 2
 #define IO_RECV 0
@@ -23,8 +24,9 @@ struct IO_MAIN_BUFFER
 
 struct IO_SIDE_BUFFER
 {
-	BYTE buff[MAX_SIDE_PACKET_SIZE];
+	BYTE* buff;
 	int size;
+	int capacity;
 };
 
 struct IO_CONTEXT
@@ -3,6 +3,7 @@
 #include "HackCheck.h"
 #include "IpManager.h"
 #include "Log.h"
+#include "MemoryAllocator.h"
 #include "PacketManager.h"
 #include "Protocol.h"
 #include "SerialCheck.h"
@@ -466,7 +467,7 @@ bool CSocketManager::DataSend(int index, BYTE* lpMsg, int size)
 
 	if (lpIoContext->IoSize > 0)
 	{
-		if ((lpIoContext->IoSideBuffer.size + size) > MAX_SIDE_PACKET_SIZE)
+		if (gMemoryAllocator.GrowSocketContext(gObj[index].PerSocketContext, (lpIoContext->IoSideBuffer.size + size)) == 0)
 		{
 			gLog.Output(LOG_CONNECT, "[SocketManager] Max msg size (Type: 2, Index: %d, Size: %d)", index, (lpIoContext->IoSideBuffer.size + size));
 			this->Disconnect(index);
@@ -525,6 +526,9 @@ void CSocketManager::Disconnect(int index)
 	gObj[index].Socket = INVALID_SOCKET;
 	gObjDel(index);
 
+	gMemoryAllocator.FreeSocketContext(gObj[index].PerSocketContext);
+	gObj[index].PerSocketContext = 0;
+
 	this->m_critical.unlock();
 }
 
@@ -544,6 +548,8 @@ void CSocketManager::OnRecv(int index, DWORD, IO_RECV_CONTEXT* lpIoContext)
 		return;
 	}
 
+	lpIoContext = &gObj[index].PerSocketContext->IoRecvContext;
+
 	while (true)
 	{
 		int capacity = MAX_MAIN_PACKET_SIZE - lpIoContext->IoMainBuffer.size;
@@ -611,6 +617,8 @@ void CSocketManager::OnSend(int index, DWORD, IO_SEND_CONTEXT* lpIoContext)
 		return;
 	}
 
+	lpIoContext = &gObj[index].PerSocketContext->IoSendContext;
+
 	FlushSendBuffer(this->m_epollFd, index, &gObj[index], lpIoContext);
 
 	this->m_critical.unlock();
@@ -675,6 +683,7 @@ DWORD CSocketManager::ServerAcceptThread(CSocketManager* lpSocketManager)
 		}
 
 		LPOBJ lpObj = &gObj[index];
+		lpObj->PerSocketContext = gMemoryAllocator.AllocSocketContext();
 		lpObj->PerSocketContext->Socket = socket;
 		lpObj->PerSocketContext->Index = index;
 
@@ -728,12 +737,12 @@ DWORD CSocketManager::ServerWorkerThread(CSocketManager* lpSocketManager)
 
 			if (events[i].events & EPOLLIN)
 			{
-				lpSocketManager->OnRecv(index, 0, &gObj[index].PerSocketContext->IoRecvContext);
+				lpSocketManager->OnRecv(index, 0, 0);
 			}
 
 			if (events[i].events & EPOLLOUT)
 			{
-				lpSocketManager->OnSend(index, 0, &gObj[index].PerSocketContext->IoSendContext);
+				lpSocketManager->OnSend(index, 0, 0);
 			}
 		}
 	}
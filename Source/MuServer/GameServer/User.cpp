@@ -6,6 +6,7 @@
 #include "BonusManager.h"
 #include "ChaosBox.h"
 #include "CommandManager.h"
+#include "CriticalSection.h"
 #include "CustomPkFree.h"
 #include "DefaultClassInfo.h"
 #include "DevilSquare.h"
@@ -42,12 +43,6 @@
 #include "Viewport.h"
 #include "Warehouse.h"
 
-int gObjCount;
-
-int gObjMonCount;
-
-int gObjCallMonCount;
-
 int gObjTotalUser;
 
 int gObjTotalMonster;
@@ -62,9 +57,17 @@ int gGameServerDisconnect;
 
 OBJECTSTRUCT_HEADER gObj;
 
-MESSAGE_STATE_MACHINE_HEADER gSMMsg;
+OBJECT_ACTIVE_LIST gObjActiveList;
+
+CCriticalSection gObjActiveListCritical;
 
-MESSAGE_STATE_ATTACK_MACHINE_HEADER gSMAttackProcMsg;
+OBJECT_FREE_LIST gObjFreeList[3];
+
+CCriticalSection gObjFreeListCritical;
+
+OBJECT_NAME_INDEX gObjNameIndex;
+
+CCriticalSection gObjNameIndexCritical;
 
 DWORD gCheckSum[MAX_CHECKSUM_KEY];
 
@@ -91,24 +94,34 @@ void gObjEventRunProc()
 
 void gObjViewportProc()
 {
-	for (int n = 0; n < MAX_OBJECT; n++)
+	OBJECT_ACTIVE_LIST ActiveList;
+
+	gObjGetActiveList(&ActiveList, OBJECT_START_MONSTER, MAX_OBJECT);
+
+	gViewport.SetViewportObjectList(&ActiveList);
+
+	gObjectManager.ObjectRegenProc();
+
+	for (int n = 0; n < ActiveList.Count; n++)
 	{
-		gObjectManager.ObjectSetStateCreate(n);
+		gObjectManager.ObjectSetStateCreate(ActiveList.Index[n]);
 	}
 
-	for (int n = 0; n < MAX_OBJECT; n++)
+	for (int n = 0; n < ActiveList.Count; n++)
 	{
-		gObjViewportListDestroy(n);
+		gObjViewportListDestroy(ActiveList.Index[n]);
 	}
 
-	for (int n = 0; n < MAX_OBJECT; n++)
+	for (int n = 0; n < ActiveList.Count; n++)
 	{
-		gObjViewportListCreate(n);
+		gObjViewportListCreate(ActiveList.Index[n]);
 	}
 
-	for (int n = 0; n < MAX_OBJECT; n++)
+	gViewport.BeginViewportRecord();
+
+	for (int n = 0; n < ActiveList.Count; n++)
 	{
-		gObjViewportListProtocol(n);
+		gObjViewportListProtocol(ActiveList.Index[n]);
 	}
 
 	gObjectManager.ObjectSetStateProc();
@@ -168,11 +181,15 @@ void gObjCloseProc()
 
 void gObjAccountLevelProc()
 {
-	for (int n = OBJECT_START_USER; n < MAX_OBJECT; n++)
+	OBJECT_ACTIVE_LIST ActiveList;
+
+	gObjGetActiveList(&ActiveList, OBJECT_START_USER, MAX_OBJECT);
+
+	for (int n = 0; n < ActiveList.Count; n++)
 	{
-		if (gObjIsConnectedGP(n) != 0)
+		if (gObjIsConnectedGP(ActiveList.Index[n]) != 0)
 		{
-			GJAccountLevelSend(n);
+			GJAccountLevelSend(ActiveList.Index[n]);
 		}
 	}
 }
@@ -189,15 +206,35 @@ void gObjInit()
 
 	gServerDisplayer.SetWindowName();
 
-	gObjCount = OBJECT_START_USER;
+	gObjFreeList[0].MinIndex = OBJECT_START_MONSTER;
+
+	gObjFreeList[0].MaxIndex = MAX_OBJECT_MONSTER;
 
-	gObjMonCount = OBJECT_START_MONSTER;
+	gObjFreeList[1].MinIndex = MAX_OBJECT_MONSTER;
 
-	gObjCallMonCount = MAX_OBJECT_MONSTER;
+	gObjFreeList[1].MaxIndex = OBJECT_START_USER;
+
+	gObjFreeList[2].MinIndex = OBJECT_START_USER;
+
+	gObjFreeList[2].MaxIndex = MAX_OBJECT;
+
+	for (int n = 0; n < 3; n++)
+	{
+		gObjFreeList[n].Count = 0;
+
+		for (int i = gObjFreeList[n].MaxIndex - 1; i >= gObjFreeList[n].MinIndex; i--)
+		{
+			gObjFreeList[n].Index[gObjFreeList[n].Count++] = i;
+		}
+	}
+
+	memset(gObjNameIndex.Head, 0xFF, sizeof(gObjNameIndex.Head));
+
+	memset(gObjNameIndex.Bucket, 0xFF, sizeof(gObjNameIndex.Bucket));
 
 	memset(gObj.CommonStruct, 0, sizeof(OBJECTSTRUCT));
 
-	gMemoryAllocator.m_TempMemoryAllocatorInfo.Alloc();
+	gMemoryAllocator.m_TempMemoryAllocatorInfo.Alloc(gMemoryAllocator.GetObjectArena(MEMORY_ALLOCATOR_TEMP_INDEX), gMemoryAllocator.GetUserArena(MEMORY_ALLOCATOR_TEMP_INDEX));
 
 	gMemoryAllocator.BindMemoryAllocatorInfo(OBJECT_START_USER, gMemoryAllocator.m_TempMemoryAllocatorInfo);
 }
@@ -264,6 +301,8 @@ void gObjCharZeroSet(int aIndex)
 
 	lpObj->Live = 0;
 
+	gObjNameIndexRemove(aIndex);
+
 	memset(lpObj->Name, 0, sizeof(lpObj->Name));
 
 	lpObj->Level = 0;
@@ -358,6 +397,8 @@ void gObjCharZeroSet(int aIndex)
 
 	lpObj->ViewSkillState = 0;
 
+	gViewport.ClearViewportRecord(lpObj);
+
 	lpObj->DieRegen = 0;
 
 	lpObj->RegenOk = 0;
@@ -478,9 +519,9 @@ void gObjCharZeroSet(int aIndex)
 
 	lpObj->LoadWarehouse = 0;
 
-	memset(lpObj->Quest, 0xFF, sizeof(lpObj->Quest));
+	memset(lpObj->UserData->Quest, 0xFF, sizeof(lpObj->UserData->Quest));
 
-	lpObj->SendQuestInfo = 0;
+	lpObj->UserData->SendQuestInfo = 0;
 
 	lpObj->CheckLifeTime = 0;
 
@@ -497,19 +538,25 @@ void gObjCharZeroSet(int aIndex)
 		lpObj->Effect[n].Clear();
 	}
 
+	memset(lpObj->EffectMask, 0, sizeof(lpObj->EffectMask));
+
 	lpObj->WarehouseNumber = 0;
 
-	lpObj->AutoAddPointCount = 0;
+	lpObj->UserData->AutoAddPointCount = 0;
+
+	lpObj->UserData->AutoResetEnable = 0;
+
+	memset(lpObj->UserData->AutoPartyPassword, 0, sizeof(lpObj->UserData->AutoPartyPassword));
 
-	lpObj->AutoResetEnable = 0;
+	memset(lpObj->UserData->AutoAddPointStats, 0, sizeof(lpObj->UserData->AutoAddPointStats));
 
-	memset(lpObj->AutoPartyPassword, 0, sizeof(lpObj->AutoPartyPassword));
+	memset(lpObj->UserData->AutoResetStats, 0, sizeof(lpObj->UserData->AutoResetStats));
 
-	memset(lpObj->AutoAddPointStats, 0, sizeof(lpObj->AutoAddPointStats));
+	lpObj->UserData->CommandManagerTransaction = 0;
 
-	memset(lpObj->AutoResetStats, 0, sizeof(lpObj->AutoResetStats));
+	gObjectManager.CharacterCalcAttributeClear(lpObj);
 
-	lpObj->CommandManagerTransaction = 0;
+	lpObj->UserData->HealthBarResync = 0;
 
 	lpObj->PotionTime = 0;
 
@@ -547,19 +594,11 @@ void gObjCharZeroSet(int aIndex)
 
 	lpObj->LastCheckTick = 0;
 
-	for (int n = 0; n < MAX_MONSTER_SEND_MSG; n++)
-	{
-		gSMMsg[aIndex][n].Clear();
-	}
-
-	for (int n = 0; n < MAX_MONSTER_SEND_ATTACK_MSG; n++)
-	{
-		gSMAttackProcMsg[aIndex][n].Clear();
-	}
+	gObjectManager.ObjectMsgClear(aIndex);
 
 	for (int n = 0; n < 100; n++)
 	{
-		lpObj->CommandLastTick[n] = 0;
+		lpObj->UserData->CommandLastTick[n] = 0;
 	}
 }
 
@@ -739,36 +778,21 @@ bool gObjAllocData(int aIndex)
 
 	if (gMemoryAllocator.GetMemoryAllocatorInfo(&MemoryAllocatorInfo, aIndex) == 0)
 	{
-		gObj.ObjectStruct[aIndex] = new OBJECTSTRUCT;
-
-		memset(gObj.ObjectStruct[aIndex], 0, sizeof(OBJECTSTRUCT));
-
 		MemoryAllocatorInfo.m_Index = aIndex;
 
 		MemoryAllocatorInfo.m_Active = 1;
 
 		MemoryAllocatorInfo.m_ActiveTime = GetTickCount();
 
-		MemoryAllocatorInfo.Alloc();
+		MemoryAllocatorInfo.Alloc(gMemoryAllocator.GetObjectArena(aIndex), gMemoryAllocator.GetUserArena(aIndex));
 
-		gMemoryAllocator.InsertMemoryAllocatorInfo(MemoryAllocatorInfo);
-
-		gMemoryAllocator.BindMemoryAllocatorInfo(aIndex, MemoryAllocatorInfo);
+		gObj.ObjectStruct[aIndex] = &gMemoryAllocator.GetObjectArena(aIndex)->Object;
 
-		if (OBJECT_MONSTER_RANGE(aIndex) != 0)
-		{
-			gObjMonCount = (((++gObjMonCount) >= MAX_OBJECT_MONSTER) ? OBJECT_START_MONSTER : gObjMonCount);
-		}
+		memset(gObj.ObjectStruct[aIndex], 0, sizeof(OBJECTSTRUCT));
 
-		if (OBJECT_SUMMON_RANGE(aIndex) != 0)
-		{
-			gObjCallMonCount = (((++gObjCallMonCount) >= OBJECT_START_USER) ? MAX_OBJECT_MONSTER : gObjCallMonCount);
-		}
+		gMemoryAllocator.InsertMemoryAllocatorInfo(MemoryAllocatorInfo);
 
-		if (OBJECT_USER_RANGE(aIndex) != 0)
-		{
-			gObjCount = (((++gObjCount) >= MAX_OBJECT) ? OBJECT_START_USER : gObjCount);
-		}
+		gMemoryAllocator.BindMemoryAllocatorInfo(aIndex, MemoryAllocatorInfo);
 	}
 	else
 	{
@@ -783,6 +807,8 @@ bool gObjAllocData(int aIndex)
 		gMemoryAllocator.BindMemoryAllocatorInfo(aIndex, MemoryAllocatorInfo);
 	}
 
+	gObjActiveListInsert(aIndex);
+
 	return 1;
 }
 
@@ -800,14 +826,62 @@ void gObjFreeData(int aIndex)
 
 		gMemoryAllocator.InsertMemoryAllocatorInfo(MemoryAllocatorInfo);
 	}
+
+	gObjActiveListRemove(aIndex);
 }
 
-short gObjAddSearch(SOCKET socket, char* IpAddress)
+int gObjGetFreeIndex(int MinIndex, int MaxIndex)
 {
 	int index = -1;
 
-	int count = gObjCount;
+	if (gMemoryAllocator.GetMemoryAllocatorFree(&index, MinIndex, MaxIndex, 10000) != 0)
+	{
+		return index;
+	}
+
+	gObjFreeListCritical.lock();
+
+	for (int n = 0; n < 3; n++)
+	{
+		OBJECT_FREE_LIST* lpList = &gObjFreeList[n];
+
+		if (lpList->MinIndex != MinIndex || lpList->MaxIndex != MaxIndex)
+		{
+			continue;
+		}
+
+		while (lpList->Count > 0)
+		{
+			int aIndex = lpList->Index[lpList->Count - 1];
+
+			if (gObj.ObjectStruct[aIndex] == gObj.CommonStruct && gObj[aIndex].Connected == OBJECT_OFFLINE)
+			{
+				index = aIndex;
+
+				break;
+			}
+
+			lpList->Count--;
+		}
+	}
+
+	gObjFreeListCritical.unlock();
+
+	if (index != -1)
+	{
+		return index;
+	}
 
+	if (gMemoryAllocator.GetMemoryAllocatorFree(&index, MinIndex, MaxIndex, 0) != 0)
+	{
+		return index;
+	}
+
+	return -1;
+}
+
+short gObjAddSearch(SOCKET socket, char* IpAddress)
+{
 	if (gGameServerLogOut != 0)
 	{
 		GCConnectAccountSend(0, 2, socket);
@@ -829,24 +903,7 @@ short gObjAddSearch(SOCKET socket, char* IpAddress)
 		return -1;
 	}
 
-	if (gMemoryAllocator.GetMemoryAllocatorFree(&index, OBJECT_START_USER, MAX_OBJECT, 10000) != 0)
-	{
-		return index;
-	}
-
-	for (int n = OBJECT_START_USER; n < MAX_OBJECT; n++)
-	{
-		if (gObj[count].Connected == OBJECT_OFFLINE)
-		{
-			return count;
-		}
-		else
-		{
-			count = (((++count) >= MAX_OBJECT) ? OBJECT_START_USER : count);
-		}
-	}
-
-	return -1;
+	return gObjGetFreeIndex(OBJECT_START_USER, MAX_OBJECT);
 }
 
 short gObjAdd(SOCKET socket, char* IpAddress, int aIndex)
@@ -947,6 +1004,8 @@ short gObjDel(int aIndex)
 
 		gLog.Output(LOG_CONNECT, "[ObjectManager][%d] DelClient (%s)", aIndex, lpObj->IpAddr);
 
+		gObjNameIndexRemove(aIndex);
+
 		memset(lpObj->Account, 0, sizeof(lpObj->Account));
 
 		memset(lpObj->PersonalCode, 0, sizeof(lpObj->PersonalCode));
@@ -972,17 +1031,160 @@ short gObjDel(int aIndex)
 	return aIndex;
 }
 
+void gObjActiveListInsert(int aIndex)
+{
+	if (OBJECT_RANGE(aIndex) == 0)
+	{
+		return;
+	}
+
+	gObjActiveListCritical.lock();
+
+	short* lpIndex = std::lower_bound(gObjActiveList.Index, &gObjActiveList.Index[gObjActiveList.Count], (short)aIndex);
+
+	if (lpIndex == &gObjActiveList.Index[gObjActiveList.Count] || (*lpIndex) != aIndex)
+	{
+		memmove((lpIndex + 1), lpIndex, (&gObjActiveList.Index[gObjActiveList.Count] - lpIndex) * sizeof(short));
+
+		(*lpIndex) = aIndex;
+
+		gObjActiveList.Count++;
+	}
+
+	gObjActiveListCritical.unlock();
+}
+
+void gObjActiveListRemove(int aIndex)
+{
+	if (OBJECT_RANGE(aIndex) == 0)
+	{
+		return;
+	}
+
+	gObjActiveListCritical.lock();
+
+	short* lpIndex = std::lower_bound(gObjActiveList.Index, &gObjActiveList.Index[gObjActiveList.Count], (short)aIndex);
+
+	if (lpIndex != &gObjActiveList.Index[gObjActiveList.Count] && (*lpIndex) == aIndex)
+	{
+		memmove(lpIndex, (lpIndex + 1), (&gObjActiveList.Index[gObjActiveList.Count] - (lpIndex + 1)) * sizeof(short));
+
+		gObjActiveList.Count--;
+	}
+
+	gObjActiveListCritical.unlock();
+}
+
+void gObjGetActiveList(OBJECT_ACTIVE_LIST* lpList, int MinIndex, int MaxIndex)
+{
+	gObjActiveListCritical.lock();
+
+	short* lpStart = std::lower_bound(gObjActiveList.Index, &gObjActiveList.Index[gObjActiveList.Count], (short)MinIndex);
+
+	short* lpEnd = std::lower_bound(lpStart, &gObjActiveList.Index[gObjActiveList.Count], (short)MaxIndex);
+
+	lpList->Count = (int)(lpEnd - lpStart);
+
+	memcpy(lpList->Index, lpStart, lpList->Count * sizeof(short));
+
+	gObjActiveListCritical.unlock();
+}
+
+int gObjNameHash(char* name)
+{
+	DWORD hash = 2166136261;
+
+	for (int n = 0; n < (int)(sizeof(gObj[0].Name) - 1) && name[n] != 0; n++)
+	{
+		hash = (hash ^ (BYTE)name[n]) * 16777619;
+	}
+
+	return (hash % MAX_OBJECT_NAME_HASH);
+}
+
+void gObjNameIndexInsert(int aIndex)
+{
+	if (OBJECT_USER_RANGE(aIndex) == 0)
+	{
+		return;
+	}
+
+	gObjNameIndexRemove(aIndex);
+
+	if (gObj[aIndex].Name[0] == 0)
+	{
+		return;
+	}
+
+	gObjNameIndexCritical.lock();
+
+	int slot = aIndex - OBJECT_START_USER;
+
+	int bucket = gObjNameHash(gObj[aIndex].Name);
+
+	gObjNameIndex.Next[slot] = gObjNameIndex.Head[bucket];
+
+	gObjNameIndex.Head[bucket] = slot;
+
+	gObjNameIndex.Bucket[slot] = bucket;
+
+	gObjNameIndexCritical.unlock();
+}
+
+void gObjNameIndexRemove(int aIndex)
+{
+	if (OBJECT_USER_RANGE(aIndex) == 0)
+	{
+		return;
+	}
+
+	gObjNameIndexCritical.lock();
+
+	int slot = aIndex - OBJECT_START_USER;
+
+	int bucket = gObjNameIndex.Bucket[slot];
+
+	if (bucket != -1)
+	{
+		short* lpLink = &gObjNameIndex.Head[bucket];
+
+		while ((*lpLink) != -1 && (*lpLink) != slot)
+		{
+			lpLink = &gObjNameIndex.Next[(*lpLink)];
+		}
+
+		if ((*lpLink) == slot)
+		{
+			(*lpLink) = gObjNameIndex.Next[slot];
+		}
+
+		gObjNameIndex.Bucket[slot] = -1;
+	}
+
+	gObjNameIndexCritical.unlock();
+}
+
 LPOBJ gObjFind(char* name)
 {
-	for (int n = OBJECT_START_USER; n < MAX_OBJECT; n++)
+	LPOBJ lpTarget = 0;
+
+	gObjNameIndexCritical.lock();
+
+	for (int slot = gObjNameIndex.Head[gObjNameHash(name)]; slot != -1; slot = gObjNameIndex.Next[slot])
 	{
+		int n = OBJECT_START_USER + slot;
+
 		if (gObjIsConnectedGP(n) != 0 && strcmp(gObj[n].Name, name) == 0)
 		{
-			return &gObj[n];
+			lpTarget = &gObj[n];
+
+			break;
 		}
 	}
 
-	return 0;
+	gObjNameIndexCritical.unlock();
+
+	return lpTarget;
 }
 
 int gObjCalcDistance(LPOBJ lpObj, LPOBJ lpTarget)
@@ -1190,7 +1392,7 @@ bool gObjCheckTeleportArea(int aIndex, int x, int y)
 		return 0;
 	}
 
-	if (gMap[lpObj->Map].CheckAttr(lpObj->X, lpObj->Y, 1) != 0 || gMap[lpObj->Map].CheckAttr(x, y, 1) != 0)
+	if (gMap[lpObj->Map].CheckSafeAttr(lpObj->X, lpObj->Y) != 0 || gMap[lpObj->Map].CheckSafeAttr(x, y) != 0)
 	{
 		return 0;
 	}
@@ -1209,7 +1411,7 @@ bool gObjCheckMapTile(LPOBJ lpObj, int type)
 	{
 		for (int y = 0; y < 3; y++)
 		{
-			if (gMap[lpObj->Map].CheckAttr((lpObj->X + x), (lpObj->Y + y), 4) == 0 && gMap[lpObj->Map].CheckAttr((lpObj->X + x), (lpObj->Y + y), 8) == 0)
+			if (gMap[lpObj->Map].CheckWalkAttr((lpObj->X + x), (lpObj->Y + y)) != 0)
 			{
 				return 0;
 			}
@@ -1417,11 +1619,7 @@ void gObjSetViewport(int aIndex, int state)
 
 				case VIEWPORT_DESTROY:
 				{
-					lpObj->VpPlayer[n].state = VIEWPORT_NONE;
-
-					lpObj->VpPlayer[n].index = -1;
-
-					lpObj->VPCount--;
+					gViewport.DelViewportObject1(aIndex, n);
 
 					break;
 				}
@@ -1441,11 +1639,7 @@ void gObjSetViewport(int aIndex, int state)
 
 				case VIEWPORT_DESTROY:
 				{
-					lpObj->VpPlayerItem[n].state = VIEWPORT_NONE;
-
-					lpObj->VpPlayerItem[n].index = -1;
-
-					lpObj->VPCountItem--;
+					gViewport.DelViewportObjectItem(aIndex, n);
 
 					break;
 				}
@@ -1471,6 +1665,12 @@ void gObjClearViewport(LPOBJ lpObj)
 		lpObj->VpPlayerItem[n].index = -1;
 	}
 
+	lpObj->VpIndex->Clear();
+
+	lpObj->VpIndex2->Clear();
+
+	lpObj->VpIndexItem->Clear();
+
 	lpObj->VPCount = 0;
 
 	lpObj->VPCount2 = 0;
@@ -2119,91 +2319,17 @@ bool gObjWarehouseSearchSerialNumber(LPOBJ lpObj, DWORD serial)
 
 void gObjAddMsgSend(LPOBJ lpObj, int MsgCode, int SendUser, int SubCode)
 {
-	for (int n = 0; n < MAX_MONSTER_SEND_MSG; n++)
-	{
-		if (gSMMsg[lpObj->Index][n].MsgCode == -1)
-		{
-			if (gSMMsg.ObjectStruct[lpObj->Index] == gSMMsg.CommonStruct)
-			{
-				gSMMsg.ObjectStruct[lpObj->Index] = new MESSAGE_STATE_MACHINE_COMMON;
-			}
-
-			if (gSMMsg.ObjectStruct[lpObj->Index]->ObjectStruct[n] == gSMMsg.ObjectStruct[lpObj->Index]->CommonStruct)
-			{
-				gSMMsg.ObjectStruct[lpObj->Index]->ObjectStruct[n] = new MESSAGE_STATE_MACHINE;
-			}
-
-			gSMMsg[lpObj->Index][n].MsgCode = MsgCode;
-
-			gSMMsg[lpObj->Index][n].MsgTime = GetTickCount();
-
-			gSMMsg[lpObj->Index][n].SendUser = SendUser;
-
-			gSMMsg[lpObj->Index][n].SubCode = SubCode;
-
-			return;
-		}
-	}
+	gObjectManager.ObjectMsgSchedule(lpObj->Index, MsgCode, SendUser, 0, SubCode);
 }
 
 void gObjAddMsgSendDelay(LPOBJ lpObj, int MsgCode, int SendUser, int MsgTimeDelay, int SubCode)
 {
-	for (int n = 0; n < MAX_MONSTER_SEND_MSG; n++)
-	{
-		if (gSMMsg[lpObj->Index][n].MsgCode == -1)
-		{
-			if (gSMMsg.ObjectStruct[lpObj->Index] == gSMMsg.CommonStruct)
-			{
-				gSMMsg.ObjectStruct[lpObj->Index] = new MESSAGE_STATE_MACHINE_COMMON;
-			}
-
-			if (gSMMsg.ObjectStruct[lpObj->Index]->ObjectStruct[n] == gSMMsg.ObjectStruct[lpObj->Index]->CommonStruct)
-			{
-				gSMMsg.ObjectStruct[lpObj->Index]->ObjectStruct[n] = new MESSAGE_STATE_MACHINE;
-			}
-
-			gSMMsg[lpObj->Index][n].MsgCode = MsgCode;
-
-			gSMMsg[lpObj->Index][n].MsgTime = GetTickCount() + MsgTimeDelay;
-
-			gSMMsg[lpObj->Index][n].SendUser = SendUser;
-
-			gSMMsg[lpObj->Index][n].SubCode = SubCode;
-
-			return;
-		}
-	}
+	gObjectManager.ObjectMsgSchedule(lpObj->Index, MsgCode, SendUser, MsgTimeDelay, SubCode);
 }
 
 void gObjAddAttackProcMsgSendDelay(LPOBJ lpObj, int MsgCode, int SendUser, int MsgTimeDelay, int SubCode, int SubCode2)
 {
-	for (int n = 0; n < MAX_MONSTER_SEND_ATTACK_MSG; n++)
-	{
-		if (gSMAttackProcMsg[lpObj->Index][n].MsgCode == -1)
-		{
-			if (gSMAttackProcMsg.ObjectStruct[lpObj->Index] == gSMAttackProcMsg.CommonStruct)
-			{
-				gSMAttackProcMsg.ObjectStruct[lpObj->Index] = new MESSAGE_STATE_ATTACK_MACHINE_COMMON;
-			}
-
-			if (gSMAttackProcMsg.ObjectStruct[lpObj->Index]->ObjectStruct[n] == gSMAttackProcMsg.ObjectStruct[lpObj->Index]->CommonStruct)
-			{
-				gSMAttackProcMsg.ObjectStruct[lpObj->Index]->ObjectStruct[n] = new MESSAGE_STATE_ATTACK_MACHINE;
-			}
-
-			gSMAttackProcMsg[lpObj->Index][n].MsgCode = MsgCode;
-
-			gSMAttackProcMsg[lpObj->Index][n].MsgTime = GetTickCount() + MsgTimeDelay;
-
-			gSMAttackProcMsg[lpObj->Index][n].SendUser = SendUser;
-
-			gSMAttackProcMsg[lpObj->Index][n].SubCode = SubCode;
-
-			gSMAttackProcMsg[lpObj->Index][n].SubCode2 = SubCode2;
-
-			return;
-		}
-	}
+	gObjectManager.ObjectAttackMsgSchedule(lpObj->Index, MsgCode, SendUser, MsgTimeDelay, SubCode, SubCode2);
 }
 
 //**************************************************************************//
@@ -2214,8 +2340,14 @@ void gObjSecondProc()
 {
 	LPOBJ lpObj;
 
-	for (int n = 0; n < MAX_OBJECT; n++)
+	OBJECT_ACTIVE_LIST ActiveList;
+
+	gObjGetActiveList(&ActiveList, OBJECT_START_MONSTER, MAX_OBJECT);
+
+	for (int i = 0; i < ActiveList.Count; i++)
 	{
+		int n = ActiveList.Index[i];
+
 		lpObj = &gObj[n];
 
 		if (lpObj->Connected > OBJECT_LOGGED)
@@ -2268,7 +2400,7 @@ void gObjSecondProc()
 
 				gObjectManager.CharacterItemDurationDown(lpObj);
 
-				if (lpObj->PartyNumber >= 0)
+				if (gParty.IsLeader(lpObj->PartyNumber, lpObj->Index) != 0)
 				{
 					gParty.GCPartyLifeSend(lpObj->PartyNumber);
 				}
@@ -2905,7 +3037,7 @@ bool gObjCheckAutoParty(LPOBJ lpObj, LPOBJ lpTarget)
 		return 0;
 	}
 
-	if (lpTarget->AutoPartyPassword[0] != 0 && strcmp(lpObj->AutoPartyPassword, lpTarget->AutoPartyPassword) != 0)
+	if (lpTarget->UserData->AutoPartyPassword[0] != 0 && strcmp(lpObj->UserData->AutoPartyPassword, lpTarget->UserData->AutoPartyPassword) != 0)
 	{
 		return 0;
 	}
@@ -25,8 +25,10 @@
 #define MAX_MESSAGE_SIZE 255
 #define MAX_CHAT_MESSAGE_SIZE 59
 #define MAX_ROAD_PATH_TABLE 16
-#define MAX_MONSTER_SEND_MSG 20
-#define MAX_MONSTER_SEND_ATTACK_MSG 30
+#define MAX_EFFECT_MASK 3
+#define MAX_OBJECT_NAME_HASH 1024
+#define MAX_VIEWPORT_RECORD 32
+#define HEALTH_BAR_RESYNC_TIME 10
 
 #define OBJECT_RANGE(x) (((x)<0)?0:((x)>=MAX_OBJECT)?0:1)
 #define OBJECT_MONSTER_RANGE(x) (((x)<OBJECT_START_MONSTER)?0:((x)>=MAX_OBJECT_MONSTER)?0:1)
@@ -156,134 +158,6 @@ enum eLanguages
 	LANGUAGE_PORTUGUESE = 2
 };
 
-struct MESSAGE_STATE_MACHINE
-{
-	MESSAGE_STATE_MACHINE()
-	{
-		this->Clear();
-	}
-
-	void Clear()
-	{
-		this->MsgCode = -1;
-		this->SendUser = -1;
-		this->MsgTime = 0;
-		this->SubCode = 0;
-	}
-
-	int MsgCode;
-	int SendUser;
-	int MsgTime;
-	int SubCode;
-};
-
-struct MESSAGE_STATE_MACHINE_COMMON
-{
-	MESSAGE_STATE_MACHINE_COMMON()
-	{
-		this->CommonStruct = new MESSAGE_STATE_MACHINE;
-
-		for (int n = 0; n < MAX_MONSTER_SEND_MSG; n++)
-		{
-			this->ObjectStruct[n] = this->CommonStruct;
-		}
-	}
-
-	MESSAGE_STATE_MACHINE& operator[](int index)
-	{
-		return (*this->ObjectStruct[index]);
-	}
-
-	MESSAGE_STATE_MACHINE* CommonStruct;
-	MESSAGE_STATE_MACHINE* ObjectStruct[MAX_MONSTER_SEND_MSG];
-};
-
-struct MESSAGE_STATE_MACHINE_HEADER
-{
-	MESSAGE_STATE_MACHINE_HEADER()
-	{
-		this->CommonStruct = new MESSAGE_STATE_MACHINE_COMMON;
-
-		for (int n = 0; n < MAX_OBJECT; n++)
-		{
-			this->ObjectStruct[n] = this->CommonStruct;
-		}
-	}
-
-	MESSAGE_STATE_MACHINE_COMMON& operator[](int index)
-	{
-		return (*this->ObjectStruct[index]);
-	}
-
-	MESSAGE_STATE_MACHINE_COMMON* CommonStruct;
-	MESSAGE_STATE_MACHINE_COMMON* ObjectStruct[MAX_OBJECT];
-};
-
-struct MESSAGE_STATE_ATTACK_MACHINE
-{
-	MESSAGE_STATE_ATTACK_MACHINE()
-	{
-		this->Clear();
-	}
-
-	void Clear()
-	{
-		this->MsgCode = -1;
-		this->SendUser = -1;
-		this->MsgTime = 0;
-		this->SubCode = 0;
-		this->SubCode2 = 0;
-	}
-
-	int MsgCode;
-	int SendUser;
-	int MsgTime;
-	int SubCode;
-	int SubCode2;
-};
-
-struct MESSAGE_STATE_ATTACK_MACHINE_COMMON
-{
-	MESSAGE_STATE_ATTACK_MACHINE_COMMON()
-	{
-		this->CommonStruct = new MESSAGE_STATE_ATTACK_MACHINE;
-
-		for (int n = 0; n < MAX_MONSTER_SEND_ATTACK_MSG; n++)
-		{
-			this->ObjectStruct[n] = this->CommonStruct;
-		}
-	}
-
-	MESSAGE_STATE_ATTACK_MACHINE& operator[](int index)
-	{
-		return (*this->ObjectStruct[index]);
-	}
-
-	MESSAGE_STATE_ATTACK_MACHINE* CommonStruct;
-	MESSAGE_STATE_ATTACK_MACHINE* ObjectStruct[MAX_MONSTER_SEND_ATTACK_MSG];
-};
-
-struct MESSAGE_STATE_ATTACK_MACHINE_HEADER
-{
-	MESSAGE_STATE_ATTACK_MACHINE_HEADER()
-	{
-		this->CommonStruct = new MESSAGE_STATE_ATTACK_MACHINE_COMMON;
-
-		for (int n = 0; n < MAX_OBJECT; n++)
-		{
-			this->ObjectStruct[n] = this->CommonStruct;
-		}
-	}
-
-	MESSAGE_STATE_ATTACK_MACHINE_COMMON& operator[](int index)
-	{
-		return (*this->ObjectStruct[index]);
-	}
-
-	MESSAGE_STATE_ATTACK_MACHINE_COMMON* CommonStruct;
-	MESSAGE_STATE_ATTACK_MACHINE_COMMON* ObjectStruct[MAX_OBJECT];
-};
-
 struct EFFECT_OPTION
 {
 	int AddPhysiDamage;
@@ -314,6 +188,13 @@ struct VIEWPORT_STRUCT
 #pragma pack()
 };
 
+struct OBJECT_VIEWPORT_RECORD
+{
+	DWORD Serial;
+	BYTE Head;
+	BYTE Data[MAX_VIEWPORT_RECORD];
+};
+
 struct HIT_DAMAGE_STRUCT
 {
 	int index;
@@ -328,6 +209,78 @@ struct INTERFACE_STATE
 	DWORD type : 10;
 };
 
+struct CHARACTER_CALC_KEY
+{
+	int Serial;
+	BYTE Class;
+	BYTE ChangeUp;
+	short Level;
+	int Strength;
+	int Dexterity;
+	int Vitality;
+	int Energy;
+	float VitalityToLife;
+	float EnergyToMana;
+};
+
+struct CHARACTER_CALC_BASE
+{
+	bool Valid;
+	bool Bow;
+	int PhysiDamageMin;
+	int PhysiDamageMax;
+	int MagicDamageMin;
+	int MagicDamageMax;
+	int DamageMultiplierRate;
+	int AttackSuccessRate;
+	int PhysiSpeed;
+	int MagicSpeed;
+	int DefenseSuccessRate;
+	int Defense;
+	float MaxLife;
+	float MaxMana;
+};
+
+struct CHARACTER_CALC_ITEM
+{
+	int Index;
+	bool Durability;
+	WORD RequireLevel;
+	WORD RequireStrength;
+	WORD RequireDexterity;
+	WORD RequireVitality;
+	WORD RequireEnergy;
+	bool Valid;
+};
+
+struct CHARACTER_CALC_CACHE
+{
+	CHARACTER_CALC_KEY Key;
+	CHARACTER_CALC_BASE Base;
+	CHARACTER_CALC_ITEM Item[INVENTORY_WEAR_SIZE];
+};
+
+struct OBJECT_USER_DATA
+{
+	BYTE Quest[50];
+	bool SendQuestInfo;
+	int ArcherCoinCount[GOLDEN_ARCHER_MAX_COINS];
+	char ArcherLuckyNumber[13];
+	std::vector<std::string> RegisteredLuckyNumbers;
+	char AccountExpireDate[20];
+	char AutoPartyPassword[11];
+	int AutoAddPointCount;
+	int AutoAddPointStats[5];
+	int AutoResetEnable;
+	int AutoResetStats[5];
+	int CommandManagerTransaction;
+	DWORD CommandLastTick[100];
+	CHARACTER_CALC_CACHE CalcCache;
+	int HealthBarCount;
+	BYTE HealthBarData[MAX_VIEWPORT * 4];
+	int HealthBarResync;
+};
+
 struct OBJECTSTRUCT
 {
 	int Index;
@@ -491,9 +444,13 @@ struct OBJECTSTRUCT
 	VIEWPORT_STRUCT* VpPlayer;
 	VIEWPORT_STRUCT* VpPlayer2;
 	VIEWPORT_STRUCT* VpPlayerItem;
+	struct VIEWPORT_INDEX* VpIndex;
+	struct VIEWPORT_INDEX* VpIndex2;
+	struct VIEWPORT_INDEX* VpIndexItem;
 	int VPCount;
 	int VPCount2;
 	int VPCountItem;
+	OBJECT_VIEWPORT_RECORD ViewportRecord;
 	HIT_DAMAGE_STRUCT* HitDamage;
 	short HitDamageCount;
 	INTERFACE_STATE Interface;
@@ -524,30 +481,19 @@ struct OBJECTSTRUCT
 	DWORD Option;
 	bool HaveWeaponInHand;
 	int LoadWarehouse;
-	BYTE Quest[50];
-	bool SendQuestInfo;
 	int CheckLifeTime;
 	BYTE LastTeleportTime;
 	BYTE ReqWarehouseOpen;
 	bool IsChaosMixCompleted;
-	int ArcherCoinCount[GOLDEN_ARCHER_MAX_COINS];
-	char ArcherLuckyNumber[13];
-	std::vector<std::string> RegisteredLuckyNumbers;
 	DWORD CharSaveTime;
 	CEffect* Effect;
+	DWORD EffectMask[MAX_EFFECT_MASK];
 	DWORD* SkillDelay;
 	DWORD* HackPacketDelay;
 	DWORD* HackPacketCount;
+	OBJECT_USER_DATA* UserData;
 	int WarehouseNumber;
 	int AccountLevel;
-	char AccountExpireDate[20];
-	char AutoPartyPassword[11];
-	int AutoAddPointCount;
-	int AutoAddPointStats[5];
-	int AutoResetEnable;
-	int AutoResetStats[5];
-	int CommandManagerTransaction;
-	DWORD CommandLastTick[100];
 	DWORD PotionTime;
 	DWORD HPAutoRecuperationTime;
 	DWORD MPAutoRecuperationTime;
@@ -631,11 +577,28 @@ struct OBJECTSTRUCT_HEADER
 
 typedef OBJECTSTRUCT* LPOBJ;
 
-extern OBJECTSTRUCT_HEADER gObj;
+struct OBJECT_ACTIVE_LIST
+{
+	int Count;
+	short Index[MAX_OBJECT];
+};
 
-extern MESSAGE_STATE_MACHINE_HEADER gSMMsg;
+struct OBJECT_FREE_LIST
+{
+	int MinIndex;
+	int MaxIndex;
+	int Count;
+	short Index[MAX_OBJECT];
+};
+
+struct OBJECT_NAME_INDEX
+{
+	short Head[MAX_OBJECT_NAME_HASH];
+	short Next[MAX_OBJECT_USER];
+	short Bucket[MAX_OBJECT_USER];
+};
 
-extern MESSAGE_STATE_ATTACK_MACHINE_HEADER gSMAttackProcMsg;
+extern OBJECTSTRUCT_HEADER gObj;
 
 extern DWORD gCheckSum[MAX_CHECKSUM_KEY];
 
@@ -681,12 +644,24 @@ bool gObjAllocData(int aIndex);
 
 void gObjFreeData(int aIndex);
 
+int gObjGetFreeIndex(int MinIndex, int MaxIndex);
+
 short gObjAddSearch(SOCKET socket, char* IpAddress);
 
 short gObjAdd(SOCKET socket, char* IpAddress, int aIndex);
 
 short gObjDel(int aIndex);
 
+void gObjActiveListInsert(int aIndex);
+
+void gObjActiveListRemove(int aIndex);
+
+void gObjGetActiveList(OBJECT_ACTIVE_LIST* lpList, int MinIndex, int MaxIndex);
+
+void gObjNameIndexInsert(int aIndex);
+
+void gObjNameIndexRemove(int aIndex);
+
 LPOBJ gObjFind(char* name);
 
 int gObjCalcDistance(LPOBJ lpObj, LPOBJ lpTarget);
@@ -799,12 +774,6 @@ void gObjAuthorityCodeSet(LPOBJ lpObj);
 void gObjUseDrink(LPOBJ lpObj, int level);
 bool gObjCheckAutoParty(LPOBJ lpObj, LPOBJ lpTarget);
 
-extern int gObjCount;
-
-extern int gObjMonCount;
-
-extern int gObjCallMonCount;
-
 extern int gObjTotalUser;
 
 extern int gObjTotalMonster;
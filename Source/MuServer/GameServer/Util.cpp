@@ -336,11 +336,13 @@ bool DataSendSocket(SOCKET socket, BYTE* lpMsg, DWORD size)
 
 void MsgSendV2(LPOBJ lpObj, BYTE* lpMsg, int size)
 {
-	for (int n = 0; n < MAX_VIEWPORT; n++)
+	for (int n = 0; n < lpObj->VpIndex2->ListCount; n++)
 	{
-		if (lpObj->VpPlayer2[n].state != VIEWPORT_NONE && lpObj->VpPlayer2[n].type == OBJECT_USER)
+		VIEWPORT_STRUCT* lpViewport = &lpObj->VpPlayer2[lpObj->VpIndex2->List[n]];
+
+		if (lpViewport->state != VIEWPORT_NONE && lpViewport->type == OBJECT_USER)
 		{
-			DataSend(lpObj->VpPlayer2[n].index, lpMsg, size);
+			DataSend(lpViewport->index, lpMsg, size);
 		}
 	}
 }
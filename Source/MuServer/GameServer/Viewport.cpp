@@ -8,9 +8,96 @@
 
 CViewport gViewport;
 
+void VIEWPORT_INDEX::Clear()
+{
+	memset(this->Head, VIEWPORT_SLOT_NONE, sizeof(this->Head));
+
+	memset(this->Next, VIEWPORT_SLOT_NONE, sizeof(this->Next));
+
+	for (int n = 0; n < MAX_VIEWPORT; n++)
+	{
+		this->Free[n] = (BYTE)((MAX_VIEWPORT - 1) - n);
+
+		this->ListPos[n] = VIEWPORT_SLOT_NONE;
+	}
+
+	this->FreeCount = MAX_VIEWPORT;
+
+	this->ListCount = 0;
+}
+
+int VIEWPORT_INDEX::Find(VIEWPORT_STRUCT* lpViewport, int index, int type)
+{
+	for (int n = this->Head[index & (MAX_VIEWPORT_HASH - 1)]; n != VIEWPORT_SLOT_NONE; n = this->Next[n])
+	{
+		if (lpViewport[n].index == index && lpViewport[n].type == type)
+		{
+			return n;
+		}
+	}
+
+	return -1;
+}
+
+int VIEWPORT_INDEX::Insert(int index)
+{
+	if (this->FreeCount <= 0)
+	{
+		return -1;
+	}
+
+	int slot = this->Free[--this->FreeCount];
+
+	int hash = index & (MAX_VIEWPORT_HASH - 1);
+
+	this->Next[slot] = this->Head[hash];
+
+	this->Head[hash] = slot;
+
+	this->ListPos[slot] = this->ListCount;
+
+	this->List[this->ListCount++] = slot;
+
+	return slot;
+}
+
+void VIEWPORT_INDEX::Remove(VIEWPORT_STRUCT* lpViewport, int slot)
+{
+	if (this->ListPos[slot] == VIEWPORT_SLOT_NONE)
+	{
+		return;
+	}
+
+	BYTE* lpLink = &this->Head[lpViewport[slot].index & (MAX_VIEWPORT_HASH - 1)];
+
+	while ((*lpLink) != VIEWPORT_SLOT_NONE && (*lpLink) != slot)
+	{
+		lpLink = &this->Next[(*lpLink)];
+	}
+
+	if ((*lpLink) == slot)
+	{
+		(*lpLink) = this->Next[slot];
+	}
+
+	this->Next[slot] = VIEWPORT_SLOT_NONE;
+
+	int pos = this->ListPos[slot];
+
+	this->List[pos] = this->List[--this->ListCount];
+
+	this->ListPos[this->List[pos]] = pos;
+
+	this->ListPos[slot] = VIEWPORT_SLOT_NONE;
+
+	this->Free[this->FreeCount++] = slot;
+}
+
 CViewport::CViewport()
 {
+	this->m_ObjectList.Count = 0;
 
+	this->m_RecordSerial = 1;
 }
 
 CViewport::~CViewport()
@@ -18,6 +105,13 @@ CViewport::~CViewport()
 
 }
 
+void CViewport::SetViewportObjectList(OBJECT_ACTIVE_LIST* lpList)
+{
+	this->m_ObjectList.Count = lpList->Count;
+
+	memcpy(this->m_ObjectList.Index, lpList->Index, lpList->Count * sizeof(short));
+}
+
 bool CViewport::CheckViewportObjectPosition(int aIndex, int map, int x, int y, int view)
 {
 	LPOBJ lpObj = &gObj[aIndex];
@@ -39,45 +133,21 @@ bool CViewport::CheckViewportObject1(int aIndex, int bIndex, int type)
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
-	{
-		if (lpObj->VpPlayer[n].state != VIEWPORT_NONE && lpObj->VpPlayer[n].index == bIndex && lpObj->VpPlayer[n].type == type)
-		{
-			return 0;
-		}
-	}
-
-	return 1;
+	return ((lpObj->VpIndex->Find(lpObj->VpPlayer, bIndex, type) == -1) ? 1 : 0);
 }
 
 bool CViewport::CheckViewportObject2(int aIndex, int bIndex, int type)
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
-	{
-		if (lpObj->VpPlayer2[n].state != VIEWPORT_NONE && lpObj->VpPlayer2[n].index == bIndex && lpObj->VpPlayer2[n].type == type)
-		{
-			return 0;
-		}
-	}
-
-	return 1;
+	return ((lpObj->VpIndex2->Find(lpObj->VpPlayer2, bIndex, type) == -1) ? 1 : 0);
 }
 
 bool CViewport::CheckViewportObjectItem(int aIndex, int bIndex, int type)
 {
 	LPOBJ lpObj = &gObj[aIndex];
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
-	{
-		if (lpObj->VpPlayerItem[n].state != VIEWPORT_NONE && lpObj->VpPlayerItem[n].index == bIndex && lpObj->VpPlayerItem[n].type == type)
-		{
-			return 0;
-		}
-	}
-
-	return 1;
+	return ((lpObj->VpIndexItem->Find(lpObj->VpPlayerItem, bIndex, type) == -1) ? 1 : 0);
 }
 
 bool CViewport::AddViewportObject1(int aIndex, int bIndex, int type)
@@ -89,23 +159,22 @@ bool CViewport::AddViewportObject1(int aIndex, int bIndex, int type)
 		return 0;
 	}
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
+	int n = lpObj->VpIndex->Insert(bIndex);
+
+	if (n == -1)
 	{
-		if (lpObj->VpPlayer[n].state == VIEWPORT_NONE)
-		{
-			lpObj->VpPlayer[n].state = VIEWPORT_SEND;
+		return 0;
+	}
 
-			lpObj->VpPlayer[n].index = bIndex;
+	lpObj->VpPlayer[n].state = VIEWPORT_SEND;
 
-			lpObj->VpPlayer[n].type = type;
+	lpObj->VpPlayer[n].index = bIndex;
 
-			lpObj->VPCount++;
+	lpObj->VpPlayer[n].type = type;
 
-			return 1;
-		}
-	}
+	lpObj->VPCount++;
 
-	return 0;
+	return 1;
 }
 
 bool CViewport::AddViewportObject2(int aIndex, int bIndex, int type)
@@ -117,23 +186,22 @@ bool CViewport::AddViewportObject2(int aIndex, int bIndex, int type)
 		return 0;
 	}
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
+	int n = lpObj->VpIndex2->Insert(bIndex);
+
+	if (n == -1)
 	{
-		if (lpObj->VpPlayer2[n].state == VIEWPORT_NONE)
-		{
-			lpObj->VpPlayer2[n].state = VIEWPORT_SEND;
+		return 0;
+	}
 
-			lpObj->VpPlayer2[n].index = bIndex;
+	lpObj->VpPlayer2[n].state = VIEWPORT_SEND;
 
-			lpObj->VpPlayer2[n].type = type;
+	lpObj->VpPlayer2[n].index = bIndex;
 
-			lpObj->VPCount2++;
+	lpObj->VpPlayer2[n].type = type;
 
-			return 1;
-		}
-	}
+	lpObj->VPCount2++;
 
-	return 0;
+	return 1;
 }
 
 bool CViewport::AddViewportObjectItem(int aIndex, int bIndex, int type)
@@ -145,23 +213,61 @@ bool CViewport::AddViewportObjectItem(int aIndex, int bIndex, int type)
 		return 0;
 	}
 
-	for (int n = 0; n < MAX_VIEWPORT; n++)
+	int n = lpObj->VpIndexItem->Insert(bIndex);
+
+	if (n == -1)
 	{
-		if (lpObj->VpPlayerItem[n].state == VIEWPORT_NONE)
-		{
-			lpObj->VpPlayerItem[n].state = VIEWPORT_SEND;
+		return 0;
+	}
 
-			lpObj->VpPlayerItem[n].index = bIndex;
+	lpObj->VpPlayerItem[n].state = VIEWPORT_SEND;
 
-			lpObj->VpPlayerItem[n].type = type;
+	lpObj->VpPlayerItem[n].index = bIndex;
 
-			lpObj->VPCountItem++;
+	lpObj->VpPlayerItem[n].type = type;
 
-			return 1;
-		}
-	}
+	lpObj->VPCountItem++;
 
-	return 0;
+	return 1;
+}
+
+void CViewport::DelViewportObject1(int aIndex, int slot)
+{
+	LPOBJ lpObj = &gObj[aIndex];
+
+	lpObj->VpIndex->Remove(lpObj->VpPlayer, slot);
+
+	lpObj->VpPlayer[slot].state = VIEWPORT_NONE;
+
+	lpObj->VpPlayer[slot].index = -1;
+
+	lpObj->VPCount--;
+}
+
+void CViewport::DelViewportObject2(int aIndex, int slot)
+{
+	LPOBJ lpObj = &gObj[aIndex];
+
+	lpObj->VpIndex2->Remove(lpObj->VpPlayer2, slot);
+
+	lpObj->VpPlayer2[slot].state = VIEWPORT_NONE;
+
+	lpObj->VpPlayer2[slot].index = -1;
+
+	lpObj->VPCount2--;
+}
+
+void CViewport::DelViewportObjectItem(int aIndex, int slot)
+{
+	LPOBJ lpObj = &gObj[aIndex];
+
+	lpObj->VpIndexItem->Remove(lpObj->VpPlayerItem, slot);
+
+	lpObj->VpPlayerItem[slot].state = VIEWPORT_NONE;
+
+	lpObj->VpPlayerItem[slot].index = -1;
+
+	lpObj->VPCountItem--;
 }
 
 void CViewport::DestroyViewportPlayer1(int aIndex)
@@ -242,22 +348,14 @@ void CViewport::DestroyViewportPlayer2(int aIndex)
 
 		if (lpTarget->Connected != OBJECT_ONLINE)
 		{
-			lpObj->VpPlayer2[n].state = VIEWPORT_NONE;
-
-			lpObj->VpPlayer2[n].index = -1;
-
-			lpObj->VPCount2--;
+			this->DelViewportObject2(aIndex, n);
 
 			continue;
 		}
 
 		if (this->CheckViewportObjectPosition(aIndex, lpTarget->Map, lpTarget->X, lpTarget->Y, gMapManager.GetMapViewRange(lpObj->Map)) == 0)
 		{
-			lpObj->VpPlayer2[n].state = VIEWPORT_NONE;
-
-			lpObj->VpPlayer2[n].index = -1;
-
-			lpObj->VPCount2--;
+			this->DelViewportObject2(aIndex, n);
 
 			continue;
 		}
@@ -342,22 +440,14 @@ void CViewport::DestroyViewportMonster2(int aIndex)
 
 		if (lpTarget->Connected != OBJECT_ONLINE)
 		{
-			lpObj->VpPlayer2[n].state = VIEWPORT_NONE;
-
-			lpObj->VpPlayer2[n].index = -1;
-
-			lpObj->VPCount2--;
+			this->DelViewportObject2(aIndex, n);
 
 			continue;
 		}
 
 		if (this->CheckViewportObjectPosition(aIndex, lpTarget->Map, lpTarget->X, lpTarget->Y, gMapManager.GetMapViewRange(lpObj->Map)) == 0)
 		{
-			lpObj->VpPlayer2[n].state = VIEWPORT_NONE;
-
-			lpObj->VpPlayer2[n].index = -1;
-
-			lpObj->VPCount2--;
+			this->DelViewportObject2(aIndex, n);
 
 			continue;
 		}
@@ -419,8 +509,12 @@ void CViewport::CreateViewportPlayer(int aIndex)
 		return;
 	}
 
-	for (int n = OBJECT_START_MONSTER; n < MAX_OBJECT; n++)
+	int ViewRange = gMapManager.GetMapViewRange(lpObj->Map);
+
+	for (int i = 0; i < this->m_ObjectList.Count; i++)
 	{
+		int n = this->m_ObjectList.Index[i];
+
 		if (gObj[n].Connected != OBJECT_ONLINE || n == aIndex)
 		{
 			continue;
@@ -431,7 +525,7 @@ void CViewport::CreateViewportPlayer(int aIndex)
 			continue;
 		}
 
-		if (this->CheckViewportObjectPosition(aIndex, gObj[n].Map, gObj[n].X, gObj[n].Y, gMapManager.GetMapViewRange(lpObj->Map)) != 0)
+		if (this->CheckViewportObjectPosition(aIndex, gObj[n].Map, gObj[n].X, gObj[n].Y, ViewRange) != 0)
 		{
 			this->AddViewportObject1(aIndex, n, gObj[n].Type);
 
@@ -449,8 +543,12 @@ void CViewport::CreateViewportMonster(int aIndex)
 		return;
 	}
 
-	for (int n = MAX_OBJECT_MONSTER; n < MAX_OBJECT; n++)
+	int ViewRange = gMapManager.GetMapViewRange(lpObj->Map);
+
+	for (int i = (int)(std::lower_bound(this->m_ObjectList.Index, &this->m_ObjectList.Index[this->m_ObjectList.Count], (short)MAX_OBJECT_MONSTER) - this->m_ObjectList.Index); i < this->m_ObjectList.Count; i++)
 	{
+		int n = this->m_ObjectList.Index[i];
+
 		if (gObj[n].Connected != OBJECT_ONLINE || n == aIndex)
 		{
 			continue;
@@ -461,7 +559,7 @@ void CViewport::CreateViewportMonster(int aIndex)
 			continue;
 		}
 
-		if (this->CheckViewportObjectPosition(aIndex, gObj[n].Map, gObj[n].X, gObj[n].Y, gMapManager.GetMapViewRange(lpObj->Map)) != 0)
+		if (this->CheckViewportObjectPosition(aIndex, gObj[n].Map, gObj[n].X, gObj[n].Y, ViewRange) != 0)
 		{
 			this->AddViewportObject1(aIndex, n, gObj[n].Type);
 
@@ -622,8 +720,6 @@ void CViewport::GCViewportPlayerSend(int aIndex)
 
 	pMsg.count = 0;
 
-	PMSG_VIEWPORT_PLAYER info;
-
 	for (int n = 0; n < MAX_VIEWPORT; n++)
 	{
 		if (lpObj->VpPlayer[n].state != VIEWPORT_SEND)
@@ -648,40 +744,9 @@ void CViewport::GCViewportPlayerSend(int aIndex)
 			continue;
 		}
 
-		info.index[0] = SET_NUMBERHB(lpTarget->Index);
-
-		info.index[1] = SET_NUMBERLB(lpTarget->Index);
-
-		if (lpTarget->State == OBJECT_CREATE && lpTarget->Teleport == 0)
-		{
-			info.index[0] |= 0x80;
-		}
-
-		info.x = (BYTE)lpTarget->X;
-
-		info.y = (BYTE)lpTarget->Y;
-
-		lpTarget->CharSet[0] &= 0xF0;
-
-		lpTarget->CharSet[0] |= lpTarget->ViewState & 0x0F;
+		memcpy(&send[size], this->GetViewportRecord(lpTarget, 0x12), sizeof(PMSG_VIEWPORT_PLAYER));
 
-		memcpy(info.CharSet, lpTarget->CharSet, sizeof(info.CharSet));
-
-		memcpy(info.name, lpTarget->Name, sizeof(info.name));
-
-		info.tx = (BYTE)lpTarget->TX;
-
-		info.ty = (BYTE)lpTarget->TY;
-
-		info.DirAndPkLevel = (lpTarget->Dir * 16) | (lpTarget->PKLevel & 0x0F);
-
-		int InfoSize = sizeof(info);
-
-		info.ViewSkillState = lpTarget->ViewSkillState;
-
-		memcpy(&send[size], &info, sizeof(info));
-
-		size += InfoSize;
+		size += sizeof(PMSG_VIEWPORT_PLAYER);
 
 		pMsg.count++;
 	}
@@ -712,8 +777,6 @@ void CViewport::GCViewportMonsterSend(int aIndex)
 
 	pMsg.count = 0;
 
-	PMSG_VIEWPORT_MONSTER info;
-
 	for (int n = 0; n < MAX_VIEWPORT; n++)
 	{
 		if (lpObj->VpPlayer[n].state != VIEWPORT_SEND)
@@ -738,39 +801,9 @@ void CViewport::GCViewportMonsterSend(int aIndex)
 			continue;
 		}
 
-		info.index[0] = SET_NUMBERHB(lpTarget->Index);
-
-		info.index[1] = SET_NUMBERLB(lpTarget->Index);
-
-		if (lpTarget->State == OBJECT_CREATE)
-		{
-			info.index[0] |= 0x80;
-
-			if (lpTarget->Teleport != 0)
-			{
-				info.index[0] |= 0x40;
-			}
-		}
-
-		info.type = lpTarget->Class;
-
-		info.x = (BYTE)lpTarget->X;
-
-		info.y = (BYTE)lpTarget->Y;
-
-		info.tx = (BYTE)lpTarget->TX;
-
-		info.ty = (BYTE)lpTarget->TY;
-
-		info.DirAndPkLevel = (lpTarget->Dir * 16) | (lpTarget->PKLevel & 0x0F);
-
-		int InfoSize = sizeof(info);
+		memcpy(&send[size], this->GetViewportRecord(lpTarget, 0x13), sizeof(PMSG_VIEWPORT_MONSTER));
 
-		info.ViewSkillState = lpTarget->ViewSkillState;
-
-		memcpy(&send[size], &info, sizeof(info));
-
-		size += InfoSize;
+		size += sizeof(PMSG_VIEWPORT_MONSTER);
 
 		pMsg.count++;
 	}
@@ -801,8 +834,6 @@ void CViewport::GCViewportSummonSend(int aIndex)
 
 	pMsg.count = 0;
 
-	PMSG_VIEWPORT_SUMMON info;
-
 	for (int n = 0; n < MAX_VIEWPORT; n++)
 	{
 		if (lpObj->VpPlayer[n].state != VIEWPORT_SEND)
@@ -827,36 +858,9 @@ void CViewport::GCViewportSummonSend(int aIndex)
 			continue;
 		}
 
-		info.index[0] = SET_NUMBERHB(lpTarget->Index);
-
-		info.index[1] = SET_NUMBERLB(lpTarget->Index);
-
-		if (lpTarget->State == OBJECT_CREATE)
-		{
-			info.index[0] |= 0x80;
-		}
-
-		info.type = lpTarget->Class;
-
-		info.x = (BYTE)lpTarget->X;
+		memcpy(&send[size], this->GetViewportRecord(lpTarget, 0x1F), sizeof(PMSG_VIEWPORT_SUMMON));
 
-		info.y = (BYTE)lpTarget->Y;
-
-		info.tx = (BYTE)lpTarget->TX;
-
-		info.ty = (BYTE)lpTarget->TY;
-
-		info.DirAndPkLevel = (lpTarget->Dir * 16) | (lpTarget->PKLevel & 0x0F);
-
-		memcpy(info.name, gObj[lpTarget->SummonIndex].Name, sizeof(info.name));
-
-		int InfoSize = sizeof(info);
-
-		info.ViewSkillState = lpTarget->ViewSkillState;
-
-		memcpy(&send[size], &info, sizeof(info));
-
-		size += InfoSize;
+		size += sizeof(PMSG_VIEWPORT_SUMMON);
 
 		pMsg.count++;
 	}
@@ -937,7 +941,7 @@ void CViewport::GCViewportItemSend(int aIndex)
 		}
 		else
 		{
-			gItemManager.ItemByteConvert(info.ItemInfo, (*lpMapItem));
+			gItemManager.ItemByteConvert(info.ItemInfo, lpMapItem);
 		}
 
 		memcpy(&send[size], &info, sizeof(info));
@@ -973,8 +977,6 @@ void CViewport::GCViewportChangeSend(int aIndex)
 
 	pMsg.count = 0;
 
-	PMSG_VIEWPORT_CHANGE info;
-
 	for (int n = 0; n < MAX_VIEWPORT; n++)
 	{
 		if (lpObj->VpPlayer[n].state != VIEWPORT_SEND)
@@ -999,42 +1001,9 @@ void CViewport::GCViewportChangeSend(int aIndex)
 			continue;
 		}
 
-		info.index[0] = SET_NUMBERHB(lpTarget->Index);
+		memcpy(&send[size], this->GetViewportRecord(lpTarget, 0x45), sizeof(PMSG_VIEWPORT_CHANGE));
 
-		info.index[1] = SET_NUMBERLB(lpTarget->Index);
-
-		if (lpTarget->State == OBJECT_CREATE && lpTarget->Teleport == 0)
-		{
-			info.index[0] |= 0x80;
-		}
-
-		info.x = (BYTE)lpTarget->X;
-
-		info.y = (BYTE)lpTarget->Y;
-
-		info.skin = lpTarget->Change;
-
-		memcpy(info.name, lpTarget->Name, sizeof(info.name));
-
-		info.tx = (BYTE)lpTarget->TX;
-
-		info.ty = (BYTE)lpTarget->TY;
-
-		info.DirAndPkLevel = (lpTarget->Dir * 16) | (lpTarget->PKLevel & 0x0F);
-
-		lpTarget->CharSet[0] &= 0xF0;
-
-		lpTarget->CharSet[0] |= lpTarget->ViewState & 0x0F;
-
-		memcpy(info.CharSet, lpTarget->CharSet, sizeof(info.CharSet));
-
-		int InfoSize = sizeof(info);
-
-		info.ViewSkillState = lpTarget->ViewSkillState;
-
-		memcpy(&send[size], &info, sizeof(info));
-
-		size += InfoSize;
+		size += sizeof(PMSG_VIEWPORT_CHANGE);
 
 		pMsg.count++;
 	}
@@ -1235,37 +1204,10 @@ void CViewport::GCViewportSimplePlayerSend(LPOBJ lpObj)
 
 	PMSG_VIEWPORT_PLAYER info;
 
-	info.index[0] = SET_NUMBERHB(lpObj->Index);
-
-	info.index[1] = SET_NUMBERLB(lpObj->Index);
-
-	if (lpObj->State == OBJECT_CREATE && lpObj->Teleport == 0)
-	{
-		info.index[0] |= 0x80;
-	}
-
-	info.x = (BYTE)lpObj->X;
-
-	info.y = (BYTE)lpObj->Y;
-
-	lpObj->CharSet[0] &= 0xF0;
-
-	lpObj->CharSet[0] |= lpObj->ViewState & 0x0F;
-
-	memcpy(info.CharSet, lpObj->CharSet, sizeof(info.CharSet));
-
-	memcpy(info.name, lpObj->Name, sizeof(info.name));
-
-	info.tx = (BYTE)lpObj->TX;
-
-	info.ty = (BYTE)lpObj->TY;
-
-	info.DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
+	this->MakeViewportPlayerRecord(lpObj, &info);
 
 	int InfoSize = sizeof(info);
 
-	info.ViewSkillState = lpObj->ViewSkillState;
-
 	memcpy(&send[size], &info, sizeof(info));
 
 	size += InfoSize;
@@ -1302,36 +1244,10 @@ void CViewport::GCViewportSimpleMonsterSend(LPOBJ lpObj)
 
 	PMSG_VIEWPORT_MONSTER info;
 
-	info.index[0] = SET_NUMBERHB(lpObj->Index);
-
-	info.index[1] = SET_NUMBERLB(lpObj->Index);
-
-	if (lpObj->State == OBJECT_CREATE)
-	{
-		info.index[0] |= 0x80;
-
-		if (lpObj->Teleport != 0)
-		{
-			info.index[0] |= 0x40;
-		}
-	}
-
-	info.type = lpObj->Class;
-
-	info.x = (BYTE)lpObj->X;
-
-	info.y = (BYTE)lpObj->Y;
-
-	info.tx = (BYTE)lpObj->TX;
-
-	info.ty = (BYTE)lpObj->TY;
-
-	info.DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
+	this->MakeViewportMonsterRecord(lpObj, &info);
 
 	int InfoSize = sizeof(info);
 
-	info.ViewSkillState = lpObj->ViewSkillState;
-
 	memcpy(&send[size], &info, sizeof(info));
 
 	size += InfoSize;
@@ -1366,33 +1282,10 @@ void CViewport::GCViewportSimpleSummonSend(LPOBJ lpObj)
 
 	PMSG_VIEWPORT_SUMMON info;
 
-	info.index[0] = SET_NUMBERHB(lpObj->Index);
-
-	info.index[1] = SET_NUMBERLB(lpObj->Index);
-
-	if (lpObj->State == OBJECT_CREATE)
-	{
-		info.index[0] |= 0x80;
-	}
-
-	info.type = lpObj->Class;
-
-	info.x = (BYTE)lpObj->X;
-
-	info.y = (BYTE)lpObj->Y;
-
-	info.tx = (BYTE)lpObj->TX;
-
-	info.ty = (BYTE)lpObj->TY;
-
-	info.DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
-
-	memcpy(info.name, gObj[lpObj->SummonIndex].Name, sizeof(info.name));
+	this->MakeViewportSummonRecord(lpObj, &info);
 
 	int InfoSize = sizeof(info);
 
-	info.ViewSkillState = lpObj->ViewSkillState;
-
 	memcpy(&send[size], &info, sizeof(info));
 
 	size += InfoSize;
@@ -1427,34 +1320,12 @@ void CViewport::GCViewportSimpleChangeSend(LPOBJ lpObj)
 
 	PMSG_VIEWPORT_CHANGE info;
 
-	info.index[0] = SET_NUMBERHB(lpObj->Index) | 0x80;
-
-	info.index[1] = SET_NUMBERLB(lpObj->Index);
-
-	info.x = (BYTE)lpObj->X;
+	this->MakeViewportChangeRecord(lpObj, &info);
 
-	info.y = (BYTE)lpObj->Y;
-
-	info.skin = lpObj->Change;
-
-	memcpy(info.name, lpObj->Name, sizeof(info.name));
-
-	info.tx = (BYTE)lpObj->TX;
-
-	info.ty = (BYTE)lpObj->TY;
-
-	info.DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
-
-	lpObj->CharSet[0] &= 0xF0;
-
-	lpObj->CharSet[0] |= lpObj->ViewState & 0x0F;
-
-	memcpy(info.CharSet, lpObj->CharSet, sizeof(info.CharSet));
+	info.index[0] |= 0x80;
 
 	int InfoSize = sizeof(info);
 
-	info.ViewSkillState = lpObj->ViewSkillState;
-
 	memcpy(&send[size], &info, sizeof(info));
 
 	size += InfoSize;
@@ -1558,4 +1429,184 @@ void CViewport::GCViewportSimpleGuildMemberSend(LPOBJ lpObj)
 	DataSend(lpObj->Index, send, size);
 
 	MsgSendV2(lpObj, send, size);
-}
\ No newline at end of file
+}
+
+void CViewport::BeginViewportRecord()
+{
+	this->m_RecordSerial = ((this->m_RecordSerial == 0xFFFFFFFF) ? 1 : (this->m_RecordSerial + 1));
+}
+
+void CViewport::ClearViewportRecord(LPOBJ lpObj)
+{
+	lpObj->ViewportRecord.Serial = 0;
+}
+
+BYTE* CViewport::GetViewportRecord(LPOBJ lpObj, BYTE head)
+{
+	if (lpObj->ViewportRecord.Serial == this->m_RecordSerial && lpObj->ViewportRecord.Head == head)
+	{
+		return lpObj->ViewportRecord.Data;
+	}
+
+	switch (head)
+	{
+		case 0x12:
+		{
+			this->MakeViewportPlayerRecord(lpObj, (PMSG_VIEWPORT_PLAYER*)lpObj->ViewportRecord.Data);
+
+			break;
+		}
+
+		case 0x13:
+		{
+			this->MakeViewportMonsterRecord(lpObj, (PMSG_VIEWPORT_MONSTER*)lpObj->ViewportRecord.Data);
+
+			break;
+		}
+
+		case 0x1F:
+		{
+			this->MakeViewportSummonRecord(lpObj, (PMSG_VIEWPORT_SUMMON*)lpObj->ViewportRecord.Data);
+
+			break;
+		}
+
+		case 0x45:
+		{
+			this->MakeViewportChangeRecord(lpObj, (PMSG_VIEWPORT_CHANGE*)lpObj->ViewportRecord.Data);
+
+			break;
+		}
+	}
+
+	lpObj->ViewportRecord.Serial = this->m_RecordSerial;
+
+	lpObj->ViewportRecord.Head = head;
+
+	return lpObj->ViewportRecord.Data;
+}
+
+void CViewport::MakeViewportPlayerRecord(LPOBJ lpObj, PMSG_VIEWPORT_PLAYER* lpInfo)
+{
+	lpInfo->index[0] = SET_NUMBERHB(lpObj->Index);
+
+	lpInfo->index[1] = SET_NUMBERLB(lpObj->Index);
+
+	if (lpObj->State == OBJECT_CREATE && lpObj->Teleport == 0)
+	{
+		lpInfo->index[0] |= 0x80;
+	}
+
+	lpInfo->x = (BYTE)lpObj->X;
+
+	lpInfo->y = (BYTE)lpObj->Y;
+
+	lpObj->CharSet[0] &= 0xF0;
+
+	lpObj->CharSet[0] |= lpObj->ViewState & 0x0F;
+
+	memcpy(lpInfo->CharSet, lpObj->CharSet, sizeof(lpInfo->CharSet));
+
+	memcpy(lpInfo->name, lpObj->Name, sizeof(lpInfo->name));
+
+	lpInfo->tx = (BYTE)lpObj->TX;
+
+	lpInfo->ty = (BYTE)lpObj->TY;
+
+	lpInfo->DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
+
+	lpInfo->ViewSkillState = lpObj->ViewSkillState;
+}
+
+void CViewport::MakeViewportMonsterRecord(LPOBJ lpObj, PMSG_VIEWPORT_MONSTER* lpInfo)
+{
+	lpInfo->index[0] = SET_NUMBERHB(lpObj->Index);
+
+	lpInfo->index[1] = SET_NUMBERLB(lpObj->Index);
+
+	if (lpObj->State == OBJECT_CREATE)
+	{
+		lpInfo->index[0] |= 0x80;
+
+		if (lpObj->Teleport != 0)
+		{
+			lpInfo->index[0] |= 0x40;
+		}
+	}
+
+	lpInfo->type = lpObj->Class;
+
+	lpInfo->x = (BYTE)lpObj->X;
+
+	lpInfo->y = (BYTE)lpObj->Y;
+
+	lpInfo->tx = (BYTE)lpObj->TX;
+
+	lpInfo->ty = (BYTE)lpObj->TY;
+
+	lpInfo->DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
+
+	lpInfo->ViewSkillState = lpObj->ViewSkillState;
+}
+
+void CViewport::MakeViewportSummonRecord(LPOBJ lpObj, PMSG_VIEWPORT_SUMMON* lpInfo)
+{
+	lpInfo->index[0] = SET_NUMBERHB(lpObj->Index);
+
+	lpInfo->index[1] = SET_NUMBERLB(lpObj->Index);
+
+	if (lpObj->State == OBJECT_CREATE)
+	{
+		lpInfo->index[0] |= 0x80;
+	}
+
+	lpInfo->type = lpObj->Class;
+
+	lpInfo->x = (BYTE)lpObj->X;
+
+	lpInfo->y = (BYTE)lpObj->Y;
+
+	lpInfo->tx = (BYTE)lpObj->TX;
+
+	lpInfo->ty = (BYTE)lpObj->TY;
+
+	lpInfo->DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
+
+	memcpy(lpInfo->name, gObj[lpObj->SummonIndex].Name, sizeof(lpInfo->name));
+
+	lpInfo->ViewSkillState = lpObj->ViewSkillState;
+}
+
+void CViewport::MakeViewportChangeRecord(LPOBJ lpObj, PMSG_VIEWPORT_CHANGE* lpInfo)
+{
+	lpInfo->index[0] = SET_NUMBERHB(lpObj->Index);
+
+	lpInfo->index[1] = SET_NUMBERLB(lpObj->Index);
+
+	if (lpObj->State == OBJECT_CREATE && lpObj->Teleport == 0)
+	{
+		lpInfo->index[0] |= 0x80;
+	}
+
+	lpInfo->x = (BYTE)lpObj->X;
+
+	lpInfo->y = (BYTE)lpObj->Y;
+
+	lpInfo->skin = lpObj->Change;
+
+	memcpy(lpInfo->name, lpObj->Name, sizeof(lpInfo->name));
+
+	lpInfo->tx = (BYTE)lpObj->TX;
+
+	lpInfo->ty = (BYTE)lpObj->TY;
+
+	lpInfo->DirAndPkLevel = (lpObj->Dir * 16) | (lpObj->PKLevel & 0x0F);
+
+	lpObj->CharSet[0] &= 0xF0;
+
+	lpObj->CharSet[0] |= lpObj->ViewState & 0x0F;
+
+	memcpy(lpInfo->CharSet, lpObj->CharSet, sizeof(lpInfo->CharSet));
+
+	lpInfo->ViewSkillState = lpObj->ViewSkillState;
+}
@@ -11,6 +11,29 @@ enum eViewportState
 	VIEWPORT_DESTROY = 3,
 };
 
+#define MAX_VIEWPORT_HASH 64
+
+#define VIEWPORT_SLOT_NONE 0xFF
+
+struct VIEWPORT_INDEX
+{
+	void Clear();
+
+	int Find(VIEWPORT_STRUCT* lpViewport, int index, int type);
+
+	int Insert(int index);
+
+	void Remove(VIEWPORT_STRUCT* lpViewport, int slot);
+
+	BYTE Head[MAX_VIEWPORT_HASH];
+	BYTE Next[MAX_VIEWPORT];
+	BYTE Free[MAX_VIEWPORT];
+	BYTE List[MAX_VIEWPORT];
+	BYTE ListPos[MAX_VIEWPORT];
+	int FreeCount;
+	int ListCount;
+};
+
 //**********************************************//
 //************ GameServer -> Client ************//
 //**********************************************//
@@ -98,6 +121,8 @@ struct PMSG_VIEWPORT_CHANGE
 	BYTE CharSet[11];
 };
 
+static_assert(sizeof(PMSG_VIEWPORT_PLAYER) <= MAX_VIEWPORT_RECORD && sizeof(PMSG_VIEWPORT_CHANGE) <= MAX_VIEWPORT_RECORD, "viewport record does not fit OBJECT_VIEWPORT_RECORD");
+
 struct PMSG_VIEWPORT_GUILD_INFO
 {
 	BYTE index[2];
@@ -123,6 +148,8 @@ public:
 
 	~CViewport();
 
+	void SetViewportObjectList(OBJECT_ACTIVE_LIST* lpList);
+
 	bool CheckViewportObjectPosition(int aIndex, int map, int x, int y, int view);
 
 	bool CheckViewportObject1(int aIndex, int bIndex, int type);
@@ -137,6 +164,12 @@ public:
 
 	bool AddViewportObjectItem(int aIndex, int bIndex, int type);
 
+	void DelViewportObject1(int aIndex, int slot);
+
+	void DelViewportObject2(int aIndex, int slot);
+
+	void DelViewportObjectItem(int aIndex, int slot);
+
 	void DestroyViewportPlayer1(int aIndex);
 
 	void DestroyViewportPlayer2(int aIndex);
@@ -184,6 +217,28 @@ public:
 	void GCViewportSimpleGuildInfoSend(LPOBJ lpObj);
 
 	void GCViewportSimpleGuildMemberSend(LPOBJ lpObj);
+
+	void BeginViewportRecord();
+
+	void ClearViewportRecord(LPOBJ lpObj);
+
+private:
+
+	BYTE* GetViewportRecord(LPOBJ lpObj, BYTE head);
+
+	void MakeViewportPlayerRecord(LPOBJ lpObj, PMSG_VIEWPORT_PLAYER* lpInfo);
+
+	void MakeViewportMonsterRecord(LPOBJ lpObj, PMSG_VIEWPORT_MONSTER* lpInfo);
+
+	void MakeViewportSummonRecord(LPOBJ lpObj, PMSG_VIEWPORT_SUMMON* lpInfo);
+
+	void MakeViewportChangeRecord(LPOBJ lpObj, PMSG_VIEWPORT_CHANGE* lpInfo);
+
+private:
+
+	OBJECT_ACTIVE_LIST m_ObjectList;
+
+	DWORD m_RecordSerial;
 };
 
 extern CViewport gViewport;
\ No newline at end of file
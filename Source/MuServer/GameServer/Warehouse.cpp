@@ -292,7 +292,7 @@ void CWarehouse::GCWarehouseListSend(LPOBJ lpObj)
 
 		info.slot = n;
 
-		gItemManager.ItemByteConvert(info.ItemInfo, lpObj->Warehouse[n]);
+		gItemManager.ItemByteConvert(info.ItemInfo, &lpObj->Warehouse[n]);
 
 		memcpy(&send[size], &info, sizeof(info));
 
@@ -14,6 +14,7 @@
 #include "../Common/Platform.h"
 
 // System includes
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <queue>
@@ -0,0 +1,249 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "Map.h"
+#include "Path.h"
+#include "User.h"
+#define private public
+#include "BonusManager.h"
+#undef private
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Bonus values as they were computed before the value table, by walking
+// every started bonus.
+
+static int BonusReferenceGetBonusValue(LPOBJ lpObj, int BonusIndex, int BonusValue, int ItemIndex, int ItemLevel, int MonsterClass, int MonsterLevel)
+{
+	for (int n = 0; n < MAX_BONUS; n++)
+	{
+		BONUS_INFO* lpInfo = &gBonusManager.m_BonusInfo[n];
+
+		if (lpInfo->State != BONUS_STATE_START)
+		{
+			continue;
+		}
+
+		for (std::vector<BONUS_VALUE_INFO>::iterator it = lpInfo->ValueInfo.begin(); it != lpInfo->ValueInfo.end(); it++)
+		{
+			if (it->BonusIndex == BonusIndex && (it->ItemIndex == -1 || it->ItemIndex == ItemIndex) && (it->ItemLevel == -1 || it->ItemLevel == ItemLevel) && (it->MapNumber == -1 || it->MapNumber == lpObj->Map) && (it->MonsterClass == -1 || it->MonsterClass == MonsterClass) && (it->MonsterLevelMin == -1 || it->MonsterLevelMin <= MonsterLevel) && (it->MonsterLevelMax == -1 || it->MonsterLevelMax >= MonsterLevel))
+			{
+				switch (it->BonusIndex)
+				{
+					case BONUS_INDEX_EXPERIENCE_RATE:
+					{
+						BonusValue += (BonusValue * it->BonusValue[lpObj->AccountLevel]) / 100;
+
+						break;
+					}
+
+					case BONUS_INDEX_ITEM_DROP_RATE:
+					{
+						BonusValue += (BonusValue * it->BonusValue[lpObj->AccountLevel]) / 100;
+
+						break;
+					}
+
+					case BONUS_INDEX_CMN_ITEM_DROP_RATE:
+					{
+						BonusValue += ((__int64)(1000000 - BonusValue) * it->BonusValue[lpObj->AccountLevel]) / 1000000;
+
+						break;
+					}
+
+					case BONUS_INDEX_EXC_ITEM_DROP_RATE:
+					{
+						BonusValue += ((__int64)(1000000 - BonusValue) * it->BonusValue[lpObj->AccountLevel]) / 1000000;
+
+						break;
+					}
+
+					case BONUS_INDEX_RESET_AMOUNT:
+					{
+						BonusValue += it->BonusValue[lpObj->AccountLevel];
+
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	return BonusValue;
+}
+
+static void BonusMakeValueInfo()
+{
+	for (int n = 0; n < MAX_BONUS; n++)
+	{
+		BONUS_INFO* lpInfo = &gBonusManager.m_BonusInfo[n];
+
+		lpInfo->BonusTime = 60;
+
+		lpInfo->StartTime.clear();
+
+		lpInfo->ValueInfo.clear();
+
+		int count = rand() % 6;
+
+		for (int i = 0; i < count; i++)
+		{
+			BONUS_VALUE_INFO info;
+
+			info.BonusIndex = rand() % (MAX_BONUS_INDEX + 1);
+
+			for (int a = 0; a < MAX_ACCOUNT_LEVEL; a++)
+			{
+				info.BonusValue[a] = rand() % 200;
+			}
+
+			info.ItemIndex = ((rand() % 3) == 0) ? (rand() % 4) : -1;
+
+			info.ItemLevel = ((rand() % 3) == 0) ? (rand() % 3) : -1;
+
+			info.MapNumber = ((rand() % 2) == 0) ? (rand() % 5) : -1;
+
+			info.MonsterClass = ((rand() % 3) == 0) ? (rand() % 4) : -1;
+
+			info.MonsterLevelMin = ((rand() % 2) == 0) ? (rand() % 50) : -1;
+
+			info.MonsterLevelMax = ((rand() % 2) == 0) ? (50 + (rand() % 50)) : -1;
+
+			lpInfo->ValueInfo.push_back(info);
+		}
+	}
+}
+
+// State changes only mark the table, which MainProc rebuilds once after
+// all bonuses were processed.
+
+static bool BonusSetStates(int percent)
+{
+	for (int n = 0; n < MAX_BONUS; n++)
+	{
+		gBonusManager.SetState(&gBonusManager.m_BonusInfo[n], (((rand() % 100) < percent) ? BONUS_STATE_START : BONUS_STATE_BLANK));
+	}
+
+	TEST_CHECK(gBonusManager.m_BonusValueDirty != 0);
+
+	gBonusManager.MainProc();
+
+	TEST_CHECK(gBonusManager.m_BonusValueDirty == 0);
+
+	return true;
+}
+
+// GetBonusValue runs on the protocol threads while the event thread
+// reloads and restarts the bonuses.
+
+static void BonusReadProc(std::atomic<bool>* lpRunning, std::atomic<int>* lpCount)
+{
+	LPOBJ lpObj = &gObj[OBJECT_START_USER + 1];
+
+	lpObj->AccountLevel = 0;
+
+	for (int n = 0; lpRunning->load() != 0; n++)
+	{
+		lpObj->Map = n % MAX_MAP;
+
+		gBonusManager.GetBonusValue(lpObj, (n % MAX_BONUS_INDEX), 1000, (n & 3), 0, 1, 30);
+
+		(*lpCount)++;
+	}
+}
+
+TEST_CASE(BonusManager)
+{
+	LPOBJ lpObj = &gObj[OBJECT_START_USER];
+
+	srand(777);
+
+	BonusMakeValueInfo();
+
+	for (int round = 0; round < 200; round++)
+	{
+		TEST_CHECK(BonusSetStates(33));
+
+		for (int n = 0; n < 5000; n++)
+		{
+			lpObj->Map = rand() % 6;
+
+			lpObj->AccountLevel = rand() % MAX_ACCOUNT_LEVEL;
+
+			int BonusIndex = rand() % (MAX_BONUS_INDEX + 1);
+
+			int BonusValue = rand() % 1000000;
+
+			int ItemIndex = rand() % 5;
+
+			int ItemLevel = rand() % 4;
+
+			int MonsterClass = rand() % 5;
+
+			int MonsterLevel = rand() % 120;
+
+			TEST_CHECK(gBonusManager.GetBonusValue(lpObj, BonusIndex, BonusValue, ItemIndex, ItemLevel, MonsterClass, MonsterLevel) == BonusReferenceGetBonusValue(lpObj, BonusIndex, BonusValue, ItemIndex, ItemLevel, MonsterClass, MonsterLevel));
+		}
+	}
+
+	// Per-kill cost of the common drop rate lookup, with no bonus and
+	// with a third of the bonuses started.
+
+	for (int n = 0; n < 2; n++)
+	{
+		TEST_CHECK(BonusSetStates(((n == 0) ? 0 : 33)));
+
+		lpObj->Map = 2;
+
+		volatile int sink = 0;
+
+		const int count = 2000000;
+
+		std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < count; i++)
+		{
+			sink += BonusReferenceGetBonusValue(lpObj, BONUS_INDEX_CMN_ITEM_DROP_RATE, 1000, (i & 3), 0, 1, 30);
+		}
+
+		std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < count; i++)
+		{
+			sink += gBonusManager.GetBonusValue(lpObj, BONUS_INDEX_CMN_ITEM_DROP_RATE, 1000, (i & 3), 0, 1, 30);
+		}
+
+		std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+		printf("GetBonusValue (%s): walk %.1f ns, table %.1f ns\n", ((n == 0) ? "no bonus" : "33% started"), (std::chrono::duration<double, std::nano>(t1 - t0).count() / count), (std::chrono::duration<double, std::nano>(t2 - t1).count() / count));
+	}
+
+	std::atomic<bool> running(1);
+
+	std::atomic<int> count(0);
+
+	std::thread reader(BonusReadProc, &running, &count);
+
+	for (int n = 0; n < 50; n++)
+	{
+		gBonusManager.Load(gPath.GetFullPath("Event\\BonusManager.dat"));
+
+		gBonusManager.Init();
+
+		BonusMakeValueInfo();
+
+		BonusSetStates(50);
+	}
+
+	running = 0;
+
+	reader.join();
+
+	TEST_CHECK(count > 0);
+
+	gBonusManager.Load(gPath.GetFullPath("Event\\BonusManager.dat"));
+
+	gBonusManager.Init();
+
+	return true;
+}
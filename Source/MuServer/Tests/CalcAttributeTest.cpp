@@ -0,0 +1,812 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "DefaultClassInfo.h"
+#include "ItemManager.h"
+#include "ItemOption.h"
+#include "ObjectManager.h"
+#include "Protocol.h"
+#include "ServerInfo.h"
+#include "User.h"
+
+// CharacterCalcAttribute as it was before the stat and item-validity
+// layers were cached. The cached version must leave the character in
+// exactly the same state.
+static void CalcAttributeReference(int aIndex)
+{
+	LPOBJ lpObj = &gObj[aIndex];
+
+	if (lpObj->Type != OBJECT_USER)
+	{
+		return;
+	}
+
+	CItem* Right = &lpObj->Inventory[0];
+
+	CItem* Left = &lpObj->Inventory[1];
+
+	CItem* Gloves = &lpObj->Inventory[5];
+
+	CItem* Wings = &lpObj->Inventory[7];
+
+	CItem* Helper = &lpObj->Inventory[8];
+
+	CItem* Amulet = &lpObj->Inventory[9];
+
+	CItem* Ring1 = &lpObj->Inventory[10];
+
+	CItem* Ring2 = &lpObj->Inventory[11];
+
+	float TotalHP = 100;
+
+	float TotalMP = 100;
+
+	float TotalBP = 100;
+
+	if ((lpObj->MaxLife + lpObj->AddLife) != 0)
+	{
+		TotalHP = (float)(lpObj->Life * 100) / (float)(lpObj->MaxLife + lpObj->AddLife);
+	}
+
+	if ((lpObj->MaxMana + lpObj->AddMana) != 0)
+	{
+		TotalMP = (float)(lpObj->Mana * 100) / (lpObj->MaxMana + lpObj->AddMana);
+	}
+
+	if ((lpObj->MaxBP + lpObj->AddBP) != 0)
+	{
+		TotalBP = (float)(lpObj->BP * 100) / (float)(lpObj->MaxBP + lpObj->AddBP);
+	}
+
+	lpObj->HaveWeaponInHand = 1;
+
+	if (Right->IsItem() == 0 && Left->IsItem() == 0)
+	{
+		lpObj->HaveWeaponInHand = 0;
+	}
+	else if (Left->IsItem() == 0 && Right->m_Index == GET_ITEM(4, 15)) // Arrow
+	{
+		lpObj->HaveWeaponInHand = 0;
+	}
+	else if (Right->IsItem() == 0)
+	{
+		if (Left->m_Index == GET_ITEM(4, 7)) // Bolt
+		{
+			lpObj->HaveWeaponInHand = 0;
+		}
+		else if (Left->m_Index >= GET_ITEM(6, 0) && Left->m_Index < GET_ITEM(7, 0)) // Shields
+		{
+			lpObj->HaveWeaponInHand = 0;
+		}
+	}
+
+	for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+	{
+		if (lpObj->Inventory[n].IsItem() != 0)
+		{
+			lpObj->Inventory[n].m_IsValidItem = 1;
+		}
+	}
+
+	lpObj->AddLife = 0;
+
+	lpObj->AddMana = 0;
+
+	lpObj->AddBP = 0;
+
+	memset(lpObj->AddResistance, 0, sizeof(lpObj->AddResistance));
+
+	gObjClearSpecialOption(lpObj);
+
+	bool change = 1;
+
+	while (change != 0)
+	{
+		change = 0;
+
+		for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+		{
+			if (lpObj->Inventory[n].m_IsValidItem != 0)
+			{
+				if (gItemManager.IsValidItem(lpObj, &lpObj->Inventory[n]) == 0)
+				{
+					change = 1;
+
+					lpObj->Inventory[n].m_IsValidItem = 0;
+				}
+			}
+		}
+	}
+
+	int Strength = lpObj->Strength;
+
+	int Dexterity = lpObj->Dexterity;
+
+	int Vitality = lpObj->Vitality;
+
+	int Energy = lpObj->Energy;
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpObj->PhysiDamageMinRight = Strength / gServerInfo.m_DWPhysiDamageMinConstA;
+
+		lpObj->PhysiDamageMaxRight = Strength / gServerInfo.m_DWPhysiDamageMaxConstA;
+
+		lpObj->PhysiDamageMinLeft = Strength / gServerInfo.m_DWPhysiDamageMinConstA;
+
+		lpObj->PhysiDamageMaxLeft = Strength / gServerInfo.m_DWPhysiDamageMaxConstA;
+
+		lpObj->MagicDamageMin = Energy / gServerInfo.m_DWMagicDamageMinConstA;
+
+		lpObj->MagicDamageMax = Energy / gServerInfo.m_DWMagicDamageMaxConstA;
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpObj->PhysiDamageMinRight = Strength / gServerInfo.m_DKPhysiDamageMinConstA;
+
+		lpObj->PhysiDamageMaxRight = Strength / gServerInfo.m_DKPhysiDamageMaxConstA;
+
+		lpObj->PhysiDamageMinLeft = Strength / gServerInfo.m_DKPhysiDamageMinConstA;
+
+		lpObj->PhysiDamageMaxLeft = Strength / gServerInfo.m_DKPhysiDamageMaxConstA;
+
+		lpObj->MagicDamageMin = Energy / gServerInfo.m_DKMagicDamageMinConstA;
+
+		lpObj->MagicDamageMax = Energy / gServerInfo.m_DKMagicDamageMaxConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		if (Right->IsItem() != 0 && Right->m_Index >= GET_ITEM(4, 0) && Right->m_Index < GET_ITEM(5, 0) && Right->m_Index != GET_ITEM(4, 15))
+		{
+			lpObj->PhysiDamageMinRight = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
+
+			lpObj->PhysiDamageMaxRight = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
+
+			lpObj->PhysiDamageMinLeft = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
+
+			lpObj->PhysiDamageMaxLeft = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
+		}
+		else if (Left->IsItem() != 0 && Left->m_Index >= GET_ITEM(4, 0) && Left->m_Index < GET_ITEM(5, 0) && Left->m_Index != GET_ITEM(4, 7))
+		{
+			lpObj->PhysiDamageMinRight = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
+
+			lpObj->PhysiDamageMaxRight = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
+
+			lpObj->PhysiDamageMinLeft = (Strength / gServerInfo.m_FEPhysiDamageMinBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMinBowConstB);
+
+			lpObj->PhysiDamageMaxLeft = (Strength / gServerInfo.m_FEPhysiDamageMaxBowConstA) + (Dexterity / gServerInfo.m_FEPhysiDamageMaxBowConstB);
+		}
+		else
+		{
+			lpObj->PhysiDamageMinRight = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMinConstA;
+
+			lpObj->PhysiDamageMaxRight = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMaxConstA;
+
+			lpObj->PhysiDamageMinLeft = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMinConstA;
+
+			lpObj->PhysiDamageMaxLeft = (Strength + Dexterity) / gServerInfo.m_FEPhysiDamageMaxConstA;
+		}
+
+		lpObj->MagicDamageMin = Energy / gServerInfo.m_FEMagicDamageMinConstA;
+
+		lpObj->MagicDamageMax = Energy / gServerInfo.m_FEMagicDamageMaxConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpObj->PhysiDamageMinRight = (Strength / gServerInfo.m_MGPhysiDamageMinConstA) + (Energy / gServerInfo.m_MGPhysiDamageMinConstB);
+
+		lpObj->PhysiDamageMaxRight = (Strength / gServerInfo.m_MGPhysiDamageMaxConstA) + (Energy / gServerInfo.m_MGPhysiDamageMaxConstB);
+
+		lpObj->PhysiDamageMinLeft = (Strength / gServerInfo.m_MGPhysiDamageMinConstA) + (Energy / gServerInfo.m_MGPhysiDamageMinConstB);
+
+		lpObj->PhysiDamageMaxLeft = (Strength / gServerInfo.m_MGPhysiDamageMaxConstA) + (Energy / gServerInfo.m_MGPhysiDamageMaxConstB);
+
+		lpObj->MagicDamageMin = Energy / gServerInfo.m_MGMagicDamageMinConstA;
+
+		lpObj->MagicDamageMax = Energy / gServerInfo.m_MGMagicDamageMaxConstA;
+	}
+
+	lpObj->DamageMultiplierRate = 200 + (Energy / gServerInfo.m_DamageMultiplierConstA[lpObj->Class]);
+
+	lpObj->DamageMultiplierRate = ((lpObj->DamageMultiplierRate > gServerInfo.m_DamageMultiplierMaxRate[lpObj->Class]) ? gServerInfo.m_DamageMultiplierMaxRate[lpObj->Class] : lpObj->DamageMultiplierRate);
+
+	if (Right->IsItem() != 0)
+	{
+		lpObj->PhysiDamageMinRight += Right->GetDamageMin();
+
+		lpObj->PhysiDamageMaxRight += Right->GetDamageMax();
+	}
+
+	if (Left->IsItem() != 0)
+	{
+		lpObj->PhysiDamageMinLeft += Left->GetDamageMin();
+
+		lpObj->PhysiDamageMaxLeft += Left->GetDamageMax();
+	}
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_DWAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_DWAttackSuccessRateConstB) / gServerInfo.m_DWAttackSuccessRateConstC) + (Strength / gServerInfo.m_DWAttackSuccessRateConstD);
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_DKAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_DKAttackSuccessRateConstB) / gServerInfo.m_DKAttackSuccessRateConstC) + (Strength / gServerInfo.m_DKAttackSuccessRateConstD);
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_FEAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_FEAttackSuccessRateConstB) / gServerInfo.m_FEAttackSuccessRateConstC) + (Strength / gServerInfo.m_FEAttackSuccessRateConstD);
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpObj->AttackSuccessRate = ((lpObj->Level) * gServerInfo.m_MGAttackSuccessRateConstA) + ((Dexterity * gServerInfo.m_MGAttackSuccessRateConstB) / gServerInfo.m_MGAttackSuccessRateConstC) + (Strength / gServerInfo.m_MGAttackSuccessRateConstD);
+	}
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_DWPhysiSpeedConstA;
+
+		lpObj->MagicSpeed = Dexterity / gServerInfo.m_DWMagicSpeedConstA;
+	}
+	if (lpObj->Class == CLASS_DK)
+	{
+		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_DKPhysiSpeedConstA;
+
+		lpObj->MagicSpeed = Dexterity / gServerInfo.m_DKMagicSpeedConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_FEPhysiSpeedConstA;
+
+		lpObj->MagicSpeed = Dexterity / gServerInfo.m_FEMagicSpeedConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpObj->PhysiSpeed = Dexterity / gServerInfo.m_MGPhysiSpeedConstA;
+
+		lpObj->MagicSpeed = Dexterity / gServerInfo.m_MGMagicSpeedConstA;
+	}
+
+	lpObj->PhysiSpeed += lpObj->DrinkSpeed;
+
+	lpObj->MagicSpeed += lpObj->DrinkSpeed;
+
+	bool RightItem = 0;
+
+	if (Right->m_Index >= GET_ITEM(0, 0) && Right->m_Index < GET_ITEM(6, 0) && Right->m_Index != GET_ITEM(4, 7) && Right->m_Index != GET_ITEM(4, 15))
+	{
+		if (Right->m_IsValidItem != 0)
+		{
+			RightItem = 1;
+		}
+	}
+
+	bool LeftItem = 0;
+
+	if (Left->m_Index >= GET_ITEM(0, 0) && Left->m_Index < GET_ITEM(6, 0) && Left->m_Index != GET_ITEM(4, 7) && Left->m_Index != GET_ITEM(4, 15))
+	{
+		if (Left->m_IsValidItem != 0)
+		{
+			LeftItem = 1;
+		}
+	}
+
+	if (RightItem != 0 && LeftItem != 0)
+	{
+		lpObj->PhysiSpeed += (Right->m_AttackSpeed + Left->m_AttackSpeed) / 2;
+
+		lpObj->MagicSpeed += (Right->m_AttackSpeed + Left->m_AttackSpeed) / 2;
+	}
+	else if (RightItem != 0)
+	{
+		lpObj->PhysiSpeed += Right->m_AttackSpeed;
+
+		lpObj->MagicSpeed += Right->m_AttackSpeed;
+	}
+	else if (LeftItem != 0)
+	{
+		lpObj->PhysiSpeed += Left->m_AttackSpeed;
+
+		lpObj->MagicSpeed += Left->m_AttackSpeed;
+	}
+
+	if (Gloves->IsItem() != 0 && Gloves->m_IsValidItem != 0)
+	{
+		lpObj->PhysiSpeed += Gloves->m_AttackSpeed;
+
+		lpObj->MagicSpeed += Gloves->m_AttackSpeed;
+	}
+
+	if (Helper->IsItem() != 0 && Helper->m_IsValidItem != 0)
+	{
+		lpObj->PhysiSpeed += Helper->m_AttackSpeed;
+
+		lpObj->MagicSpeed += Helper->m_AttackSpeed;
+	}
+
+	if (Amulet->IsItem() != 0 && Amulet->m_IsValidItem != 0)
+	{
+		lpObj->PhysiSpeed += Amulet->m_AttackSpeed;
+
+		lpObj->MagicSpeed += Amulet->m_AttackSpeed;
+	}
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_DWDefenseSuccessRateConstA;
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_DKDefenseSuccessRateConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_FEDefenseSuccessRateConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpObj->DefenseSuccessRate = Dexterity / gServerInfo.m_MGDefenseSuccessRateConstA;
+	}
+
+	lpObj->DefenseSuccessRate += lpObj->Inventory[1].GetDefenseSuccessRate();
+
+	lpObj->DefenseSuccessRate += lpObj->Inventory[2].GetDefenseSuccessRate();
+
+	lpObj->DefenseSuccessRate += lpObj->Inventory[3].GetDefenseSuccessRate();
+
+	lpObj->DefenseSuccessRate += lpObj->Inventory[4].GetDefenseSuccessRate();
+
+	lpObj->DefenseSuccessRate += lpObj->Inventory[5].GetDefenseSuccessRate();
+
+	lpObj->DefenseSuccessRate += lpObj->Inventory[6].GetDefenseSuccessRate();
+
+	lpObj->DefenseSuccessRate += lpObj->Inventory[7].GetDefenseSuccessRate();
+
+	int LastItemIndex = -1;
+
+	for (int n = 2; n <= 6; n++)
+	{
+		if (n == 2 && lpObj->Class == CLASS_MG)
+		{
+			continue;
+		}
+
+		if (lpObj->Inventory[n].IsItem() == 0 || lpObj->Inventory[n].m_IsValidItem == 0 || (LastItemIndex != -1 && (lpObj->Inventory[n].m_Index % MAX_ITEM_TYPE) != LastItemIndex))
+		{
+			lpObj->ArmorSetBonus = 0;
+
+			break;
+		}
+		else
+		{
+			lpObj->ArmorSetBonus = 1;
+
+			LastItemIndex = lpObj->Inventory[n].m_Index % MAX_ITEM_TYPE;
+		}
+	}
+
+	int Level11Count = 0;
+
+	int Level10Count = 0;
+
+	int Level12Count = 0;
+
+	int Level13Count = 0;
+
+	int Level14Count = 0;
+
+	int Level15Count = 0;
+
+	if (lpObj->ArmorSetBonus != 0)
+	{
+		for (int n = 2; n <= 6; n++)
+		{
+			if (n == 2 && lpObj->Class == CLASS_MG)
+			{
+				Level15Count++;
+
+				continue;
+			}
+
+			if (lpObj->Inventory[n].m_Level == 10)
+			{
+				Level10Count++;
+			}
+			else if (lpObj->Inventory[n].m_Level == 11)
+			{
+				Level11Count++;
+			}
+			else if (lpObj->Inventory[n].m_Level == 12)
+			{
+				Level12Count++;
+			}
+			else if (lpObj->Inventory[n].m_Level == 13)
+			{
+				Level13Count++;
+			}
+			else if (lpObj->Inventory[n].m_Level == 14)
+			{
+				Level14Count++;
+			}
+			else if (lpObj->Inventory[n].m_Level == 15)
+			{
+				Level15Count++;
+			}
+		}
+
+		lpObj->DefenseSuccessRate += (lpObj->DefenseSuccessRate * 10) / 100;
+	}
+
+	if (lpObj->Class == CLASS_DW)
+	{
+		lpObj->Defense = Dexterity / gServerInfo.m_DWDefenseConstA;
+	}
+	else if (lpObj->Class == CLASS_DK)
+	{
+		lpObj->Defense = Dexterity / gServerInfo.m_DKDefenseConstA;
+	}
+	else if (lpObj->Class == CLASS_FE)
+	{
+		lpObj->Defense = Dexterity / gServerInfo.m_FEDefenseConstA;
+	}
+	else if (lpObj->Class == CLASS_MG)
+	{
+		lpObj->Defense = Dexterity / gServerInfo.m_MGDefenseConstA;
+	}
+
+	lpObj->Defense += lpObj->Inventory[1].GetDefense();
+
+	lpObj->Defense += lpObj->Inventory[2].GetDefense();
+
+	lpObj->Defense += lpObj->Inventory[3].GetDefense();
+
+	lpObj->Defense += lpObj->Inventory[4].GetDefense();
+
+	lpObj->Defense += lpObj->Inventory[5].GetDefense();
+
+	lpObj->Defense += lpObj->Inventory[6].GetDefense();
+
+	lpObj->Defense += lpObj->Inventory[7].GetDefense();
+
+	if (lpObj->ArmorSetBonus != 0 && (Level15Count + Level14Count + Level13Count + Level12Count + Level11Count + Level10Count) >= 5)
+	{
+		if (Level15Count == 5)
+		{
+			lpObj->Defense += (lpObj->Defense * 30) / 100;
+		}
+		else if (Level14Count == 5 || (Level14Count + Level15Count) == 5)
+		{
+			lpObj->Defense += (lpObj->Defense * 25) / 100;
+		}
+		else if (Level13Count == 5 || (Level13Count + Level14Count + Level15Count) == 5)
+		{
+			lpObj->Defense += (lpObj->Defense * 20) / 100;
+		}
+		else if (Level12Count == 5 || (Level12Count + Level13Count + Level14Count + Level15Count) == 5)
+		{
+			lpObj->Defense += (lpObj->Defense * 15) / 100;
+		}
+		else if (Level11Count == 5 || (Level11Count + Level12Count + Level13Count + Level14Count + Level15Count) == 5)
+		{
+			lpObj->Defense += (lpObj->Defense * 10) / 100;
+		}
+		else if (Level10Count == 5 || (Level10Count + Level11Count + Level12Count + Level13Count + Level14Count + Level15Count) == 5)
+		{
+			lpObj->Defense += (lpObj->Defense * 5) / 100;
+		}
+	}
+
+	lpObj->Resistance[0] = GET_MAX_RESISTANCE(Amulet->m_Resistance[0], Ring1->m_Resistance[0], Ring2->m_Resistance[0]);
+
+	lpObj->Resistance[1] = GET_MAX_RESISTANCE(Amulet->m_Resistance[1], Ring1->m_Resistance[1], Ring2->m_Resistance[1]);
+
+	lpObj->Resistance[2] = GET_MAX_RESISTANCE(Amulet->m_Resistance[2], Ring1->m_Resistance[2], Ring2->m_Resistance[2]);
+
+	lpObj->Resistance[3] = GET_MAX_RESISTANCE(Amulet->m_Resistance[3], Ring1->m_Resistance[3], Ring2->m_Resistance[3]);
+
+	gObjCalcExperience(lpObj);
+
+	gItemOption.CalcItemCommonOption(lpObj);
+
+	if (Right->m_Index >= GET_ITEM(4, 0) && Right->m_Index < GET_ITEM(5, 0) && Right->m_Index != GET_ITEM(4, 15) && Right->m_Slot == 0)
+	{
+		if (Left->m_Index == GET_ITEM(4, 7) && Left->m_Level > 0)
+		{
+			lpObj->PhysiDamageMinRight += ((lpObj->PhysiDamageMinRight * ((Left->m_Level * 2) + 1)) / 100) + 1;
+
+			lpObj->PhysiDamageMaxRight += ((lpObj->PhysiDamageMinRight * ((Left->m_Level * 2) + 1)) / 100) + 1;
+		}
+	}
+	else if (Left->m_Index >= GET_ITEM(4, 0) && Left->m_Index < GET_ITEM(5, 0) && Left->m_Index != GET_ITEM(4, 7) && Left->m_Slot == 1)
+	{
+		if (Right->m_Index == GET_ITEM(4, 15) && Right->m_Level > 0)
+		{
+			lpObj->PhysiDamageMinLeft += ((lpObj->PhysiDamageMinLeft * ((Right->m_Level * 2) + 1)) / 100) + 1;
+
+			lpObj->PhysiDamageMaxLeft += ((lpObj->PhysiDamageMinLeft * ((Right->m_Level * 2) + 1)) / 100) + 1;
+		}
+	}
+
+	if (lpObj->Class == CLASS_DK || lpObj->Class == CLASS_MG)
+	{
+		if (Right->IsItem() != 0 && Left->IsItem() != 0)
+		{
+			if (Right->m_Index >= GET_ITEM(0, 0) && Right->m_Index < GET_ITEM(4, 0) && Left->m_Index >= GET_ITEM(0, 0) && Left->m_Index < GET_ITEM(4, 0))
+			{
+				lpObj->PhysiDamageMinRight = (lpObj->PhysiDamageMinRight * 55) / 100;
+
+				lpObj->PhysiDamageMaxRight = (lpObj->PhysiDamageMaxRight * 55) / 100;
+
+				lpObj->PhysiDamageMinLeft = (lpObj->PhysiDamageMinLeft * 55) / 100;
+
+				lpObj->PhysiDamageMaxLeft = (lpObj->PhysiDamageMaxLeft * 55) / 100;
+			}
+		}
+	}
+
+	lpObj->MaxLife = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].MaxLife;
+
+	lpObj->MaxMana = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].MaxMana;
+
+	lpObj->MaxLife += gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].LevelLife * (lpObj->Level - 1);
+
+	lpObj->MaxMana += gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].LevelMana * (lpObj->Level - 1);
+
+	lpObj->MaxLife += ((lpObj->Vitality - gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].Vitality)) * lpObj->VitalityToLife;
+
+	lpObj->MaxMana += ((lpObj->Energy - gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].Energy)) * lpObj->EnergyToMana;
+
+	if (Helper->IsItem() != 0 && Helper->m_IsValidItem != 0)
+	{
+		if (Helper->m_Index == GET_ITEM(13, 0)) // Angel
+		{
+			lpObj->AddLife += 50;
+		}
+	}
+
+	gObjectManager.CharacterCalcBP(lpObj);
+
+	lpObj->AddLife += (int)(lpObj->MaxLife * lpObj->EffectOption.MulMaxHP) / 100;
+
+	lpObj->Life = ((lpObj->MaxLife + lpObj->AddLife) * TotalHP) / 100;
+
+	lpObj->Life = ((lpObj->Life > (lpObj->MaxLife + lpObj->AddLife)) ? (lpObj->MaxLife + lpObj->AddLife) : lpObj->Life);
+
+	lpObj->Mana = ((lpObj->MaxMana + lpObj->AddMana) * TotalMP) / 100;
+
+	lpObj->Mana = ((lpObj->Mana > (lpObj->MaxMana + lpObj->AddMana)) ? (lpObj->MaxMana + lpObj->AddMana) : lpObj->Mana);
+
+	lpObj->BP = (int)(((lpObj->MaxBP + lpObj->AddBP) * TotalBP) / 100);
+
+	lpObj->BP = (int)(((lpObj->BP > (lpObj->MaxBP + lpObj->AddBP)) ? (lpObj->MaxBP + lpObj->AddBP) : lpObj->BP));
+
+#if(GAMESERVER_EXTRA==0)
+
+	GCLifeSend(aIndex, 0xFE, (int)(lpObj->MaxLife + lpObj->AddLife));
+
+	GCLifeSend(aIndex, 0xFF, (int)lpObj->Life);
+
+	GCManaSend(aIndex, 0xFE, (int)(lpObj->MaxMana + lpObj->AddMana), (lpObj->MaxBP + lpObj->AddBP));
+
+	GCManaSend(aIndex, 0xFF, (int)lpObj->Mana, lpObj->BP);
+
+#else
+
+	GCNewCharacterCalcSend(lpObj);
+
+#endif
+}
+
+static std::vector<int> gCalcItemList[INVENTORY_WEAR_SIZE];
+
+static void CalcAttributeMakeItemList()
+{
+	for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+	{
+		gCalcItemList[n].clear();
+	}
+
+	for (int n = 0; n < MAX_ITEM; n++)
+	{
+		ITEM_INFO* lpItemInfo = gItemManager.GetInfo(n);
+
+		if (lpItemInfo == 0 || lpItemInfo->Slot < 0 || lpItemInfo->Slot >= INVENTORY_WEAR_SIZE)
+		{
+			continue;
+		}
+
+		gCalcItemList[lpItemInfo->Slot].push_back(n);
+
+		if (lpItemInfo->Slot == 0)
+		{
+			gCalcItemList[1].push_back(n);
+		}
+
+		if (lpItemInfo->Slot == 10)
+		{
+			gCalcItemList[11].push_back(n);
+		}
+	}
+}
+
+static void CalcAttributeEquip(LPOBJ lpObj, int slot)
+{
+	lpObj->Inventory[slot].Clear();
+
+	if (gCalcItemList[slot].empty() != 0 || (rand() % 6) == 0)
+	{
+		return;
+	}
+
+	lpObj->Inventory[slot].m_Level = rand() % 16;
+
+	lpObj->Inventory[slot].Convert(gCalcItemList[slot][rand() % gCalcItemList[slot].size()], rand() % 2, rand() % 2, rand() % 5, rand() % 64);
+
+	lpObj->Inventory[slot].m_Durability = (float)(((rand() % 8) == 0) ? 0 : 100);
+}
+
+static void CalcAttributeReroll(LPOBJ lpObj)
+{
+	lpObj->Class = rand() % MAX_CLASS;
+
+	lpObj->ChangeUp = rand() % 2;
+
+	lpObj->DBClass = (lpObj->Class * 16) + lpObj->ChangeUp;
+
+	lpObj->Level = 1 + (rand() % 400);
+
+	lpObj->Strength = 15 + (rand() % 1500);
+
+	lpObj->Dexterity = 15 + (rand() % 1500);
+
+	lpObj->Vitality = 15 + (rand() % 1500);
+
+	lpObj->Energy = 15 + (rand() % 1500);
+
+	lpObj->VitalityToLife = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].VitalityToLife;
+
+	lpObj->EnergyToMana = gDefaultClassInfo.m_DefaultClassInfo[lpObj->Class].EnergyToMana;
+}
+
+static void CalcAttributeReload()
+{
+	switch (rand() % 3)
+	{
+		case 0:
+			gServerInfo.ReadCharacterInfo();
+			return;
+		case 1:
+			gServerInfo.m_DKPhysiDamageMinConstA = 1 + (rand() % 10);
+			gServerInfo.m_DWMagicDamageMaxConstA = 1 + (rand() % 10);
+			gServerInfo.m_FEDefenseConstA = 1 + (rand() % 10);
+			gServerInfo.m_MGAttackSuccessRateConstA = 1 + (rand() % 10);
+			break;
+		case 2:
+			gDefaultClassInfo.m_DefaultClassInfo[rand() % MAX_CLASS].LevelLife = (float)(1 + (rand() % 5));
+			gDefaultClassInfo.m_DefaultClassInfo[rand() % MAX_CLASS].MaxMana = (float)(10 + (rand() % 50));
+			break;
+	}
+
+	gObjectManager.CharacterCalcAttributeReset();
+}
+
+TEST_CASE(CalcAttribute)
+{
+	int aIndex = OBJECT_START_USER;
+
+	gObjAllocData(aIndex);
+
+	LPOBJ lpObj = &gObj[aIndex];
+
+	gObjSetInventory1Pointer(lpObj);
+
+	gObjCharZeroSet(aIndex);
+
+	lpObj->Type = OBJECT_USER;
+
+	lpObj->Connected = OBJECT_ONLINE;
+
+	lpObj->Socket = INVALID_SOCKET;
+
+	CalcAttributeMakeItemList();
+
+	srand(12345);
+
+	CalcAttributeReroll(lpObj);
+
+	for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+	{
+		CalcAttributeEquip(lpObj, n);
+	}
+
+	lpObj->Life = 50;
+
+	lpObj->Mana = 50;
+
+	static BYTE SaveObj[sizeof(OBJECTSTRUCT)];
+
+	static BYTE ReferenceObj[sizeof(OBJECTSTRUCT)];
+
+	static CItem SaveItem[INVENTORY_WEAR_SIZE];
+
+	static CItem ReferenceItem[INVENTORY_WEAR_SIZE];
+
+	int mismatch = 0;
+
+	for (int step = 0; step < 20000; step++)
+	{
+		switch (rand() % 10)
+		{
+			case 0:
+				CalcAttributeReroll(lpObj);
+				break;
+			case 1:
+				lpObj->Strength += rand() % 50;
+				break;
+			case 2:
+				lpObj->Level = 1 + (rand() % 400);
+				break;
+			case 3:
+			case 4:
+			case 5:
+				CalcAttributeEquip(lpObj, rand() % INVENTORY_WEAR_SIZE);
+				break;
+			case 6:
+			{
+				CItem* lpItem = &lpObj->Inventory[rand() % INVENTORY_WEAR_SIZE];
+				lpItem->m_Durability = (float)((lpItem->m_Durability == 0) ? 50 : 0);
+				break;
+			}
+			case 7:
+				lpObj->DrinkSpeed = rand() % 20;
+				break;
+			case 8:
+				if ((rand() % 20) == 0)
+				{
+					CalcAttributeReload();
+				}
+				break;
+		}
+
+		memcpy(SaveObj, lpObj, sizeof(OBJECTSTRUCT));
+
+		for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+		{
+			SaveItem[n] = lpObj->Inventory[n];
+		}
+
+		CalcAttributeReference(aIndex);
+
+		memcpy(ReferenceObj, lpObj, sizeof(OBJECTSTRUCT));
+
+		for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+		{
+			ReferenceItem[n] = lpObj->Inventory[n];
+		}
+
+		memcpy(lpObj, SaveObj, sizeof(OBJECTSTRUCT));
+
+		for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+		{
+			lpObj->Inventory[n] = SaveItem[n];
+		}
+
+		gObjectManager.CharacterCalcAttribute(aIndex);
+
+		bool match = (memcmp(ReferenceObj, lpObj, sizeof(OBJECTSTRUCT)) == 0);
+
+		for (int n = 0; n < INVENTORY_WEAR_SIZE; n++)
+		{
+			match = match && (memcmp(&ReferenceItem[n], &lpObj->Inventory[n], sizeof(CItem)) == 0);
+		}
+
+		if (match == false && (mismatch++) < 5)
+		{
+			TestFail(__FILE__, __LINE__, "step %d class %d level %d differs from the reference", step, lpObj->Class, lpObj->Level);
+		}
+	}
+
+	gServerInfo.ReadCharacterInfo();
+
+	TEST_CHECK(mismatch == 0);
+
+	return true;
+}
@@ -0,0 +1,138 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "ItemManager.h"
+
+// Item encoding as it ran before ItemByteConvert took a pointer, on a copy
+// of the item.
+
+static void ItemByteConvertReference(BYTE* lpMsg, CItem item)
+{
+	lpMsg[0] = item.m_Index & 0xFF;
+
+	lpMsg[1] = 0;
+	lpMsg[1] |= item.m_Level * 8;
+	lpMsg[1] |= item.m_SkillOption * 128;
+	lpMsg[1] |= item.m_LuckOption * 4;
+	lpMsg[1] |= item.m_AddOption & 3;
+
+	lpMsg[2] = (BYTE)item.m_Durability;
+
+	lpMsg[3] = 0;
+	lpMsg[3] |= (item.m_Index & 256) >> 1;
+	lpMsg[3] |= ((item.m_AddOption > 3) ? 64 : 0);
+	lpMsg[3] |= item.m_ExceOption;
+}
+
+static void ItemByteConvertMakeItem(CItem* lpItem, int index, int level, int option, BYTE ExceOption)
+{
+	lpItem->Clear();
+
+	lpItem->m_Level = level;
+
+	lpItem->Convert(index, (option & 1), ((option / 2) & 1), ((option / 4) & 7), ExceOption);
+
+	lpItem->m_Durability = (float)((index + (level * 17) + option) % 256);
+}
+
+static bool ItemByteConvertCheck(CItem* lpItem)
+{
+	BYTE ItemInfo[MAX_ITEM_INFO];
+
+	BYTE ReferenceInfo[MAX_ITEM_INFO];
+
+	memset(ItemInfo, 0xCC, sizeof(ItemInfo));
+
+	memset(ReferenceInfo, 0x33, sizeof(ReferenceInfo));
+
+	gItemManager.ItemByteConvert(ItemInfo, lpItem);
+
+	ItemByteConvertReference(ReferenceInfo, (*lpItem));
+
+	TEST_CHECK(memcmp(ItemInfo, ReferenceInfo, MAX_ITEM_INFO) == 0);
+
+	return true;
+}
+
+TEST_CASE(ItemByteConvert)
+{
+	static const BYTE ExceOptionList[8] = {0, 1, 2, 4, 8, 16, 32, 63};
+
+	CItem item;
+
+	int count = 0;
+
+	for (int n = 0; n < MAX_ITEM; n++)
+	{
+		if (gItemManager.GetInfo(n) == 0)
+		{
+			continue;
+		}
+
+		for (int level = 0; level < 16; level++)
+		{
+			for (int option = 0; option < 32; option++)
+			{
+				for (int i = 0; i < 8; i++)
+				{
+					ItemByteConvertMakeItem(&item, n, level, option, ExceOptionList[i]);
+
+					TEST_CHECK(ItemByteConvertCheck(&item));
+
+					count++;
+				}
+			}
+		}
+	}
+
+	TEST_CHECK(count > 0);
+
+	// Known encodings pin the wire layout itself, low index byte, level and
+	// options, durability, then the high index bit, high add option bit and
+	// excellent options.
+
+	BYTE ItemInfo[MAX_ITEM_INFO];
+
+	item.Clear();
+
+	item.m_Index = GET_ITEM(0, 1);
+
+	item.m_Level = 7;
+
+	item.m_SkillOption = 1;
+
+	item.m_LuckOption = 1;
+
+	item.m_AddOption = 5;
+
+	item.m_ExceOption = 0x21;
+
+	item.m_Durability = 30;
+
+	gItemManager.ItemByteConvert(ItemInfo, &item);
+
+	TEST_CHECK(ItemInfo[0] == 1 && ItemInfo[1] == 189 && ItemInfo[2] == 30 && ItemInfo[3] == 97);
+
+	item.Clear();
+
+	item.m_Index = GET_ITEM(8, 3);
+
+	item.m_Level = 15;
+
+	item.m_SkillOption = 0;
+
+	item.m_LuckOption = 0;
+
+	item.m_AddOption = 0;
+
+	item.m_ExceOption = 0;
+
+	item.m_Durability = 255;
+
+	gItemManager.ItemByteConvert(ItemInfo, &item);
+
+	TEST_CHECK(ItemInfo[0] == 3 && ItemInfo[1] == 120 && ItemInfo[2] == 255 && ItemInfo[3] == 128);
+
+	printf("ItemByteConvert: %d items compared\n", count);
+
+	return true;
+}
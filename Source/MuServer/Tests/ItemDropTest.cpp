@@ -0,0 +1,286 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "ItemManager.h"
+#include "Map.h"
+#include "Path.h"
+#include "RandomManager.h"
+#include "User.h"
+#include "Util.h"
+#define private public
+#include "ItemDrop.h"
+#undef private
+#include <chrono>
+
+// Drop rule filter and pick as they ran before the drop index, by walking
+// every rule on each kill.
+
+static bool ItemDropReferenceCheck(ITEM_DROP_INFO* lpInfo, LPOBJ lpObj)
+{
+	if (gItemManager.GetInfo(lpInfo->Index) == 0)
+	{
+		return 0;
+	}
+
+	if (lpInfo->MapNumber != -1 && lpInfo->MapNumber != lpObj->Map)
+	{
+		return 0;
+	}
+
+	if (lpInfo->MonsterClass != -1 && lpInfo->MonsterClass != lpObj->Class)
+	{
+		return 0;
+	}
+
+	if (lpInfo->MonsterLevelMin != -1 && lpInfo->MonsterLevelMin > lpObj->Level)
+	{
+		return 0;
+	}
+
+	if (lpInfo->MonsterLevelMax != -1 && lpInfo->MonsterLevelMax < lpObj->Level)
+	{
+		return 0;
+	}
+
+	return 1;
+}
+
+static ITEM_DROP_INFO* ItemDropReferenceGetInfo(LPOBJ lpObj, LPOBJ lpTarget)
+{
+	CRandomManager RandomManager;
+
+	for (std::vector<ITEM_DROP_INFO>::iterator it = gItemDrop.m_ItemDropInfo.begin(); it != gItemDrop.m_ItemDropInfo.end(); it++)
+	{
+		if (ItemDropReferenceCheck(&(*it), lpObj) == 0)
+		{
+			continue;
+		}
+
+		int DropRate;
+
+		if ((DropRate = it->DropRate) == -1 || (GetLargeRand() % 1000000) < (DropRate = gItemDrop.GetItemDropRate(lpObj, lpTarget, it->Index, it->Level, it->DropRate)))
+		{
+			int rate = (1000000 / ((DropRate == -1) ? 1000000 : DropRate));
+
+			RandomManager.AddElement(reinterpret_cast<intptr_t>(&(*it)), rate);
+		}
+	}
+
+	intptr_t dropPtr = 0;
+
+	if (RandomManager.GetRandomElement(&dropPtr) == 0)
+	{
+		return 0;
+	}
+
+	return reinterpret_cast<ITEM_DROP_INFO*>(dropPtr);
+}
+
+// The indexed list for a monster, after the per-kill item and class
+// checks, must hold the rules the full walk accepts, in file order.
+
+static bool ItemDropCheckList(LPOBJ lpObj)
+{
+	int level = (int)(std::upper_bound(gItemDrop.m_ItemDropLevel.begin(), gItemDrop.m_ItemDropLevel.end(), lpObj->Level) - gItemDrop.m_ItemDropLevel.begin());
+
+	std::vector<int>* lpItemDropList = &gItemDrop.m_ItemDropList[lpObj->Map][level];
+
+	std::vector<int> IndexList;
+
+	for (std::vector<int>::iterator it = lpItemDropList->begin(); it != lpItemDropList->end(); it++)
+	{
+		ITEM_DROP_INFO* lpInfo = &gItemDrop.m_ItemDropInfo[(*it)];
+
+		if (gItemManager.GetInfo(lpInfo->Index) != 0 && (lpInfo->MonsterClass == -1 || lpInfo->MonsterClass == lpObj->Class))
+		{
+			IndexList.push_back((*it));
+		}
+	}
+
+	std::vector<int> ReferenceList;
+
+	for (int n = 0; n < (int)gItemDrop.m_ItemDropInfo.size(); n++)
+	{
+		if (ItemDropReferenceCheck(&gItemDrop.m_ItemDropInfo[n], lpObj) != 0)
+		{
+			ReferenceList.push_back(n);
+		}
+	}
+
+	TEST_CHECK(IndexList == ReferenceList);
+
+	return true;
+}
+
+static bool ItemDropCheckLists(LPOBJ lpObj)
+{
+	std::vector<int> classes;
+
+	classes.push_back(0);
+
+	classes.push_back(MAX_OBJECT_MONSTER);
+
+	for (std::vector<ITEM_DROP_INFO>::iterator it = gItemDrop.m_ItemDropInfo.begin(); it != gItemDrop.m_ItemDropInfo.end(); it++)
+	{
+		classes.push_back(it->MonsterClass);
+	}
+
+	for (int n = 0; n < MAX_MAP; n++)
+	{
+		for (int i = 0; i <= 400; i++)
+		{
+			for (std::vector<int>::iterator it = classes.begin(); it != classes.end(); it++)
+			{
+				lpObj->Map = n;
+
+				lpObj->Level = i;
+
+				lpObj->Class = (*it);
+
+				if (ItemDropCheckList(lpObj) == false)
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+// Two-sample chi-square of the picked rule over many kills, against the
+// Wilson-Hilferty bound at z = 4.
+
+static bool ItemDropCheckPick(LPOBJ lpObj, LPOBJ lpTarget, int count)
+{
+	std::map<intptr_t, int> ReferenceCount;
+
+	std::map<intptr_t, int> IndexCount;
+
+	std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+	for (int n = 0; n < count; n++)
+	{
+		ReferenceCount[reinterpret_cast<intptr_t>(ItemDropReferenceGetInfo(lpObj, lpTarget))]++;
+	}
+
+	std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+	for (int n = 0; n < count; n++)
+	{
+		IndexCount[reinterpret_cast<intptr_t>(gItemDrop.GetItemDropInfo(lpObj, lpTarget))]++;
+	}
+
+	std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+	std::map<intptr_t, int> bins = ReferenceCount;
+
+	bins.insert(IndexCount.begin(), IndexCount.end());
+
+	double chi = 0;
+
+	int df = -1;
+
+	for (std::map<intptr_t, int>::iterator it = bins.begin(); it != bins.end(); it++)
+	{
+		double a = ReferenceCount[it->first];
+
+		double b = IndexCount[it->first];
+
+		if ((a + b) < 10)
+		{
+			continue;
+		}
+
+		chi += ((a - b) * (a - b)) / (a + b);
+
+		df++;
+	}
+
+	printf("DropItem map %d class %d level %d: %d rules, chi2 %.2f df %d, walk %.0f ns, index %.0f ns\n", lpObj->Map, lpObj->Class, lpObj->Level, (df + 1), chi, df, (std::chrono::duration<double, std::nano>(t1 - t0).count() / count), (std::chrono::duration<double, std::nano>(t2 - t1).count() / count));
+
+	if (df > 0)
+	{
+		double h = 2.0 / (9.0 * df);
+
+		TEST_CHECK(chi < (df * pow((1.0 - h + (4.0 * sqrt(h))), 3)));
+	}
+
+	return true;
+}
+
+static void ItemDropMakeInfo()
+{
+	std::vector<ITEM_DROP_INFO> ItemDropInfo = gItemDrop.m_ItemDropInfo;
+
+	gItemDrop.m_ItemDropInfo.clear();
+
+	for (int n = 0; n < 60; n++)
+	{
+		ITEM_DROP_INFO info = ItemDropInfo[rand() % ItemDropInfo.size()];
+
+		info.MapNumber = ((rand() % 3) == 0) ? (rand() % 4) : -1;
+
+		info.MonsterClass = ((rand() % 3) == 0) ? (rand() % 4) : -1;
+
+		info.MonsterLevelMin = ((rand() % 2) == 0) ? (rand() % 100) : -1;
+
+		info.MonsterLevelMax = ((rand() % 2) == 0) ? (50 + (rand() % 100)) : -1;
+
+		info.DropRate = ((rand() % 4) == 0) ? -1 : (1000 + (rand() % 500000));
+
+		gItemDrop.m_ItemDropInfo.push_back(info);
+	}
+
+	// Unknown items stay in the rules and must never drop.
+
+	gItemDrop.m_ItemDropInfo[0].Index = GET_ITEM(15, 511);
+
+	gItemDrop.MakeItemDropList();
+}
+
+TEST_CASE(ItemDrop)
+{
+	LPOBJ lpObj = &gObj[0];
+
+	LPOBJ lpTarget = &gObj[OBJECT_START_USER];
+
+	lpTarget->Map = 0;
+
+	lpTarget->AccountLevel = 0;
+
+	srand(47);
+
+	TEST_CHECK(ItemDropCheckLists(lpObj));
+
+	static const int ItemDropShipped[4][3] = {{0, 3, 10}, {2, 20, 50}, {7, 60, 80}, {0, 3, 150}};
+
+	for (int n = 0; n < 4; n++)
+	{
+		lpObj->Map = ItemDropShipped[n][0];
+
+		lpObj->Class = ItemDropShipped[n][1];
+
+		lpObj->Level = ItemDropShipped[n][2];
+
+		TEST_CHECK(ItemDropCheckPick(lpObj, lpTarget, 100000));
+	}
+
+	for (int n = 0; n < 5; n++)
+	{
+		ItemDropMakeInfo();
+
+		TEST_CHECK(ItemDropCheckLists(lpObj));
+
+		lpObj->Map = rand() % 4;
+
+		lpObj->Class = rand() % 4;
+
+		lpObj->Level = rand() % 150;
+
+		TEST_CHECK(ItemDropCheckPick(lpObj, lpTarget, 100000));
+	}
+
+	gItemDrop.Load(gPath.GetFullPath("Item\\ItemDrop.txt"));
+
+	return true;
+}
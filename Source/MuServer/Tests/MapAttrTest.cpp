@@ -0,0 +1,276 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "Map.h"
+#include "Path.h"
+#include "ServerInfo.h"
+
+// Attribute queries as they were answered before the bit-planes, by
+// decoding m_MapAttr directly.
+
+static BYTE MapReferenceGetAttr(CMap* lpMap, int x, int y)
+{
+	if (x < 0 || x >= lpMap->m_width || y < 0 || y >= lpMap->m_height)
+	{
+		return 4;
+	}
+
+	return lpMap->m_MapAttr[(y * lpMap->m_height) + x];
+}
+
+static BYTE MapReferenceGetNeighborMask(CMap* lpMap, int x, int y)
+{
+	static const int NeighborDir[8][2] = {{-1, -1}, {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}};
+
+	if (x < 0 || x >= lpMap->m_width || y < 0 || y >= lpMap->m_height)
+	{
+		return 0;
+	}
+
+	BYTE mask = 0;
+
+	for (int n = 0; n < 8; n++)
+	{
+		int nx = x + NeighborDir[n][0];
+
+		int ny = y + NeighborDir[n][1];
+
+		if (nx < 0 || nx >= lpMap->m_width || ny < 0 || ny >= lpMap->m_height)
+		{
+			continue;
+		}
+
+		if (lpMap->m_MapAttr[nx + ny * lpMap->m_width] > MAP_ATTR_SAFTYZONE)
+		{
+			continue;
+		}
+
+		mask |= 1 << n;
+	}
+
+	return mask;
+}
+
+static BYTE MapReferenceCheckWall(CMap* lpMap, int sx, int sy, int tx, int ty, bool stand)
+{
+	int Index = ((BYTE)sy * 256 + (BYTE)sx);
+
+	int px = abs(tx - sx);
+
+	int py = abs(ty - sy);
+
+	int nx = ((tx < sx) ? -1 : 1);
+
+	int ny = ((ty < sy) ? -256 : 256);
+
+	int len1 = ((px > py) ? px : py);
+
+	int len2 = ((px > py) ? py : px);
+
+	int d1 = ((px > py) ? ny : nx);
+
+	int d2 = ((px > py) ? nx : ny);
+
+	int error = 0;
+
+	for (int count = 0; count <= len1; count++)
+	{
+		if (stand != 0 && (lpMap->m_MapAttr[Index] & 2) == 2)
+		{
+			return 2;
+		}
+
+		if ((lpMap->m_MapAttr[Index] & 4) == 4)
+		{
+			return ((stand == 0) ? 0 : 4);
+		}
+
+		error += len2;
+
+		if (error > (len1 / 2))
+		{
+			Index += d1;
+
+			error -= len1;
+		}
+
+		Index += d2;
+	}
+
+	return 1;
+}
+
+static int MapCompareCell(CMap* lpMap, int x, int y)
+{
+	int mismatch = 0;
+
+	BYTE attr = MapReferenceGetAttr(lpMap, x, y);
+
+	for (int n = 0; n < 5; n++)
+	{
+		mismatch += (lpMap->CheckAttr(x, y, (1 << n)) != ((attr & (1 << n)) != 0));
+	}
+
+	mismatch += (lpMap->CheckStandAttr(x, y) != ((attr & (MAP_ATTR_STAND | MAP_ATTR_BLOCK | MAP_ATTR_HOLLOW)) == 0));
+
+	mismatch += (lpMap->CheckWalkAttr(x, y) != ((attr & (MAP_ATTR_BLOCK | MAP_ATTR_HOLLOW)) == 0));
+
+	mismatch += (lpMap->CheckSafeAttr(x, y) != ((attr & MAP_ATTR_SAFTYZONE) != 0));
+
+	mismatch += (lpMap->GetNeighborMask(x, y) != MapReferenceGetNeighborMask(lpMap, x, y));
+
+	return mismatch;
+}
+
+static int MapCompareLine(CMap* lpMap, int sx, int sy)
+{
+	int mismatch = 0;
+
+	for (int n = 0; n < 4; n++)
+	{
+		int tx = sx + (rand() % 31) - 15;
+
+		int ty = sy + (rand() % 31) - 15;
+
+		tx = ((tx < 0) ? 0 : ((tx >= lpMap->m_width) ? (lpMap->m_width - 1) : tx));
+
+		ty = ((ty < 0) ? 0 : ((ty >= lpMap->m_height) ? (lpMap->m_height - 1) : ty));
+
+		mismatch += ((lpMap->CheckWall(sx, sy, tx, ty) != 0) != (MapReferenceCheckWall(lpMap, sx, sy, tx, ty, 0) != 0));
+
+		mismatch += (lpMap->CheckWall2(sx, sy, tx, ty) != MapReferenceCheckWall(lpMap, sx, sy, tx, ty, 1));
+	}
+
+	return mismatch;
+}
+
+static int MapCompareAll(CMap* lpMap)
+{
+	int mismatch = 0;
+
+	for (int y = -1; y <= lpMap->m_height; y++)
+	{
+		for (int x = -1; x <= lpMap->m_width; x++)
+		{
+			mismatch += MapCompareCell(lpMap, x, y);
+
+			if (x >= 0 && x < lpMap->m_width && y >= 0 && y < lpMap->m_height)
+			{
+				mismatch += MapCompareLine(lpMap, x, y);
+			}
+		}
+	}
+
+	return mismatch;
+}
+
+TEST_CASE(MapAttr)
+{
+	int WallCacheSwitch = gServerInfo.m_MapWallCacheSwitch;
+
+	int count = 0;
+
+	srand(4321);
+
+	for (int n = 0; n < MAX_MAP; n++)
+	{
+		char path[256];
+
+		wsprintf(path, "Terrain\\Terrain%d.att", (n + 1));
+
+		FILE* file;
+
+		if (fopen_s(&file, gPath.GetFullPath(path), "r") != 0)
+		{
+			continue;
+		}
+
+		fclose(file);
+
+		CMap* lpMap = new CMap;
+
+		lpMap->Load(gPath.GetFullPath(path), n);
+
+		TEST_CHECK(lpMap->m_MapAttr != 0);
+
+		for (int cache = 0; cache < 2; cache++)
+		{
+			gServerInfo.m_MapWallCacheSwitch = cache;
+
+			int mismatch = MapCompareAll(lpMap);
+
+			if (mismatch != 0)
+			{
+				TestFail(__FILE__, __LINE__, "%s: %d loaded queries differ (wall cache %d)", path, mismatch, cache);
+
+				gServerInfo.m_MapWallCacheSwitch = WallCacheSwitch;
+
+				return false;
+			}
+		}
+
+		for (int step = 0; step < 20000; step++)
+		{
+			int x = rand() % lpMap->m_width;
+
+			int y = rand() % lpMap->m_height;
+
+			BYTE attr = 1 << (rand() % 5);
+
+			switch (rand() % 4)
+			{
+				case 0:
+					lpMap->SetAttr(x, y, attr);
+					break;
+				case 1:
+					lpMap->DelAttr(x, y, attr);
+					break;
+				case 2:
+					lpMap->SetStandAttr(x, y);
+					break;
+				case 3:
+					lpMap->DelStandAttr(x, y);
+					break;
+			}
+
+			int mismatch = 0;
+
+			for (int dy = -1; dy <= 1; dy++)
+			{
+				for (int dx = -1; dx <= 1; dx++)
+				{
+					mismatch += MapCompareCell(lpMap, x + dx, y + dy);
+				}
+			}
+
+			mismatch += MapCompareLine(lpMap, x, y);
+
+			if (mismatch != 0)
+			{
+				TestFail(__FILE__, __LINE__, "%s: %d queries differ after update %d at %d,%d", path, mismatch, step, x, y);
+
+				gServerInfo.m_MapWallCacheSwitch = WallCacheSwitch;
+
+				return false;
+			}
+		}
+
+		int mismatch = MapCompareAll(lpMap);
+
+		gServerInfo.m_MapWallCacheSwitch = WallCacheSwitch;
+
+		if (mismatch != 0)
+		{
+			TestFail(__FILE__, __LINE__, "%s: %d queries differ after updates", path, mismatch);
+
+			return false;
+		}
+
+		delete lpMap;
+
+		count++;
+	}
+
+	TEST_CHECK(count > 0);
+
+	return true;
+}
@@ -0,0 +1,169 @@
+#include "stdafx.h"
+#include "Test.h"
+#define private public
+#include "MapFlow.h"
+#undef private
+#include "Map.h"
+
+#define MAP_FLOW_TEST_INDEX 1234
+
+static bool MapFlowCheckWalk(CMap* lpMap, int x, int y)
+{
+	if (x < 0 || x >= lpMap->m_width || y < 0 || y >= lpMap->m_height)
+	{
+		return false;
+	}
+
+	return ((lpMap->m_MapAttr[(y * lpMap->m_width) + x] & ~MAP_ATTR_STAND) <= MAP_ATTR_SAFTYZONE);
+}
+
+static MAP_FLOW_FIELD* MapFlowGetTargetField(CMapFlow* lpFlow, int* count)
+{
+	MAP_FLOW_FIELD* lpTargetField = 0;
+
+	(*count) = 0;
+
+	for (int n = 0; n < MAX_MAP_FLOW_FIELD; n++)
+	{
+		if (lpFlow->m_Field[n].TargetIndex == MAP_FLOW_TEST_INDEX)
+		{
+			lpTargetField = &lpFlow->m_Field[n];
+
+			(*count)++;
+		}
+	}
+
+	return lpTargetField;
+}
+
+// A monster chases a target that steps to a random walkable neighbor
+// every tick. The field of the target must be rebuilt only when the
+// target leaves its cell, and never exist twice.
+
+TEST_CASE(MapFlow)
+{
+	CMap* lpMap = &gMap[0];
+
+	TEST_CHECK(lpMap->m_MapAttr != 0);
+
+	CMapFlow* lpFlow = new CMapFlow;
+
+	lpFlow->SetMapDimensions(lpMap->m_width, lpMap->m_height, lpMap->m_MapAttr, lpMap->m_NeighborMask);
+
+	srand(31);
+
+	int tx = 0;
+
+	int ty = 0;
+
+	do
+	{
+		tx = 60 + (rand() % 136);
+
+		ty = 60 + (rand() % 136);
+	}
+	while (MapFlowCheckWalk(lpMap, tx, ty) == false);
+
+	int mx = tx;
+
+	int my = ty;
+
+	int steps = 4000;
+
+	int rebuilds = 0;
+
+	int chase = 0;
+
+	int miss = 0;
+
+	for (int n = 0; n < steps; n++)
+	{
+		int dir = rand() % 8;
+
+		int nx = tx + lpFlow->m_PathDir[dir * 2];
+
+		int ny = ty + lpFlow->m_PathDir[dir * 2 + 1];
+
+		if (nx >= 24 && nx < (lpMap->m_width - 24) && ny >= 24 && ny < (lpMap->m_height - 24) && MapFlowCheckWalk(lpMap, nx, ny) != false)
+		{
+			tx = nx;
+
+			ty = ny;
+		}
+
+		if ((n % 50) == 0)
+		{
+			do
+			{
+				mx = tx + (rand() % 31) - 15;
+
+				my = ty + (rand() % 31) - 15;
+			}
+			while (MapFlowCheckWalk(lpMap, mx, my) == false);
+		}
+
+		int count;
+
+		MAP_FLOW_FIELD* lpField = MapFlowGetTargetField(lpFlow, &count);
+
+		int CenterX = ((lpField == 0) ? -1 : lpField->TargetX);
+
+		int CenterY = ((lpField == 0) ? -1 : lpField->TargetY);
+
+		DWORD Time = ((lpField == 0) ? 0 : lpField->Time);
+
+		bool result = lpFlow->FindPath(mx, my, MAP_FLOW_TEST_INDEX, tx, ty, tx, ty, 1);
+
+		lpField = MapFlowGetTargetField(lpFlow, &count);
+
+		TEST_CHECK(count == 1);
+
+		TEST_CHECK(abs(lpField->TargetX - tx) <= MAP_FLOW_CELL && abs(lpField->TargetY - ty) <= MAP_FLOW_CELL);
+
+		if (lpField->TargetX != CenterX || lpField->TargetY != CenterY || lpField->Time != Time)
+		{
+			rebuilds++;
+		}
+
+		if (abs(mx - tx) > (MAP_FLOW_CELL + 1) || abs(my - ty) > (MAP_FLOW_CELL + 1))
+		{
+			chase++;
+
+			miss += (result == false);
+		}
+
+		if (result == false)
+		{
+			continue;
+		}
+
+		TEST_CHECK(lpFlow->GetPathX()[0] == mx && lpFlow->GetPathY()[0] == my);
+
+		for (int i = 1; i < lpFlow->GetPath(); i++)
+		{
+			int px = lpFlow->GetPathX()[i];
+
+			int py = lpFlow->GetPathY()[i];
+
+			TEST_CHECK(abs(px - lpFlow->GetPathX()[i - 1]) <= 1 && abs(py - lpFlow->GetPathY()[i - 1]) <= 1);
+
+			TEST_CHECK(MapFlowCheckWalk(lpMap, px, py));
+		}
+
+		int step = ((lpFlow->GetPath() > 2) ? 2 : (lpFlow->GetPath() - 1));
+
+		mx = lpFlow->GetPathX()[step];
+
+		my = lpFlow->GetPathY()[step];
+	}
+
+	printf("MapFlow: %d steps, %d away from the target, %d without path, %d field builds\n", steps, chase, miss, rebuilds);
+
+	TEST_CHECK(miss <= (chase / 10));
+
+	TEST_CHECK(rebuilds < (steps / 2));
+
+	delete lpFlow;
+
+	return true;
+}
@@ -0,0 +1,98 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "Map.h"
+#include "MapPath.h"
+#include "ServerInfo.h"
+
+#define MAP_PATH_TEST_START 128
+
+static bool MapPathCheckPath(CMapPath* lpPath, BYTE* MapAttr, int startx, int starty)
+{
+	TEST_CHECK(lpPath->GetPath() > 1 && lpPath->GetPath() <= (MAX_PATH_STEP + 1));
+
+	TEST_CHECK(lpPath->GetPathX()[0] == startx && lpPath->GetPathY()[0] == starty);
+
+	for (int n = 1; n < lpPath->GetPath(); n++)
+	{
+		int x = lpPath->GetPathX()[n];
+
+		int y = lpPath->GetPathY()[n];
+
+		TEST_CHECK(abs(x - lpPath->GetPathX()[n - 1]) <= 1 && abs(y - lpPath->GetPathY()[n - 1]) <= 1);
+
+		TEST_CHECK(MapAttr[(y * TERRAIN_SIZE) + x] == MAP_ATTR_NONE);
+	}
+
+	return true;
+}
+
+// With no node budget the search must explore every cell in range, so a
+// walled-in target ends on a cell straight across the wall from it, and an
+// open target is reached in as many steps as it is away.
+
+TEST_CASE(MapPath)
+{
+	int budget = gServerInfo.m_MonsterPathNodeBudget;
+
+	gServerInfo.m_MonsterPathNodeBudget = 0;
+
+	BYTE* MapAttr = new BYTE[TERRAIN_SIZE * TERRAIN_SIZE];
+
+	CMapPath* lpPath = new CMapPath;
+
+	lpPath->SetMapDimensions(TERRAIN_SIZE, TERRAIN_SIZE, MapAttr, 0);
+
+	srand(30);
+
+	int sx = MAP_PATH_TEST_START;
+
+	int sy = MAP_PATH_TEST_START;
+
+	for (int n = 0; n < 200; n++)
+	{
+		int tx = sx + (rand() % 21) - 10;
+
+		int ty = sy + (rand() % 21) - 10;
+
+		if (abs(tx - sx) < 3 && abs(ty - sy) < 3)
+		{
+			continue;
+		}
+
+		memset(MapAttr, MAP_ATTR_NONE, (TERRAIN_SIZE * TERRAIN_SIZE));
+
+		TEST_CHECK(lpPath->FindPath2(sx, sy, tx, ty));
+
+		TEST_CHECK(MapPathCheckPath(lpPath, MapAttr, sx, sy));
+
+		TEST_CHECK(lpPath->GetPathX()[lpPath->GetPath() - 1] == tx && lpPath->GetPathY()[lpPath->GetPath() - 1] == ty);
+
+		TEST_CHECK((lpPath->GetPath() - 1) == std::max(abs(tx - sx), abs(ty - sy)));
+
+		for (int y = (ty - 1); y <= (ty + 1); y++)
+		{
+			for (int x = (tx - 1); x <= (tx + 1); x++)
+			{
+				MapAttr[(y * TERRAIN_SIZE) + x] = MAP_ATTR_BLOCK;
+			}
+		}
+
+		TEST_CHECK(lpPath->FindPath2(sx, sy, tx, ty));
+
+		TEST_CHECK(MapPathCheckPath(lpPath, MapAttr, sx, sy));
+
+		int x = lpPath->GetPathX()[lpPath->GetPath() - 1];
+
+		int y = lpPath->GetPathY()[lpPath->GetPath() - 1];
+
+		TEST_CHECK(std::max(abs(x - tx), abs(y - ty)) == 2 && std::min(abs(x - tx), abs(y - ty)) == 0);
+	}
+
+	delete lpPath;
+
+	delete[] MapAttr;
+
+	gServerInfo.m_MonsterPathNodeBudget = budget;
+
+	return true;
+}
@@ -0,0 +1,145 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "User.h"
+
+#define NAME_INDEX_USER_START (OBJECT_START_USER + 100)
+#define NAME_INDEX_USER_COUNT 64
+#define NAME_INDEX_NAME_COUNT 40
+
+// Name lookup as it was answered before the name index, by scanning
+// every user slot.
+
+static LPOBJ NameIndexReferenceFind(char* name)
+{
+	for (int n = OBJECT_START_USER; n < MAX_OBJECT; n++)
+	{
+		if (gObjIsConnectedGP(n) != 0 && strcmp(gObj[n].Name, name) == 0)
+		{
+			return &gObj[n];
+		}
+	}
+
+	return 0;
+}
+
+static void NameIndexMakeName(char* name, int index)
+{
+	memset(name, 0, 11);
+
+	switch (index % 3)
+	{
+		case 0:
+		{
+			wsprintf(name, "Name%d", (index / 3));
+
+			break;
+		}
+
+		case 1:
+		{
+			wsprintf(name, "name%d", (index / 3));
+
+			break;
+		}
+
+		case 2:
+		{
+			wsprintf(name, "LongName%02d", (index / 3));
+
+			break;
+		}
+	}
+}
+
+// Character select sets the name and inserts it, a character switch
+// writes the new name over the old one, a disconnect clears it.
+
+static void NameIndexSetName(int aIndex, char* name)
+{
+	LPOBJ lpObj = &gObj[aIndex];
+
+	memset(lpObj->Name, 0, sizeof(lpObj->Name));
+
+	strcpy_s(lpObj->Name, name);
+
+	lpObj->Connected = OBJECT_ONLINE;
+
+	gObjNameIndexInsert(aIndex);
+}
+
+static void NameIndexDisconnect(int aIndex)
+{
+	gObjCharZeroSet(aIndex);
+
+	gObj[aIndex].Connected = OBJECT_OFFLINE;
+}
+
+TEST_CASE(NameIndex)
+{
+	srand(7);
+
+	for (int n = NAME_INDEX_USER_START; n < (NAME_INDEX_USER_START + NAME_INDEX_USER_COUNT); n++)
+	{
+		gObjAllocData(n);
+
+		gObjSetInventory1Pointer(&gObj[n]);
+
+		gObjCharZeroSet(n);
+
+		gObj[n].Type = OBJECT_USER;
+
+		gObj[n].Connected = OBJECT_OFFLINE;
+
+		gObj[n].Socket = INVALID_SOCKET;
+	}
+
+	for (int n = 0; n < 50000; n++)
+	{
+		int aIndex = NAME_INDEX_USER_START + (rand() % NAME_INDEX_USER_COUNT);
+
+		char name[11];
+
+		NameIndexMakeName(name, (rand() % NAME_INDEX_NAME_COUNT));
+
+		if ((rand() % 3) == 0)
+		{
+			NameIndexDisconnect(aIndex);
+		}
+		else if (NameIndexReferenceFind(name) == 0)
+		{
+			NameIndexSetName(aIndex, name);
+		}
+
+		for (int i = 0; i < NAME_INDEX_NAME_COUNT; i++)
+		{
+			NameIndexMakeName(name, i);
+
+			TEST_CHECK(gObjFind(name) == NameIndexReferenceFind(name));
+		}
+	}
+
+	// Names past the stored length hash on their first ten characters and
+	// must not match the stored prefix.
+
+	char query[32];
+
+	wsprintf(query, "LongName00X");
+
+	TEST_CHECK(gObjFind(query) == 0);
+
+	for (int n = NAME_INDEX_USER_START; n < (NAME_INDEX_USER_START + NAME_INDEX_USER_COUNT); n++)
+	{
+		NameIndexDisconnect(n);
+
+		gObj[n].Type = OBJECT_EMPTY;
+	}
+
+	for (int n = 0; n < NAME_INDEX_NAME_COUNT; n++)
+	{
+		NameIndexMakeName(query, n);
+
+		TEST_CHECK(gObjFind(query) == 0);
+	}
+
+	return true;
+}
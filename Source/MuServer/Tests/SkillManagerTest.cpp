@@ -0,0 +1,167 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "User.h"
+#define private public
+#include "SkillManager.h"
+#undef private
+#include <chrono>
+
+// Skill lookups as they ran before the flat table, through a map keyed
+// by skill index that copied the record out on every query.
+
+static std::map<int, SKILL_INFO> SkillReferenceInfo;
+
+static bool SkillReferenceGetInfo(int index, SKILL_INFO* lpInfo)
+{
+	std::map<int, SKILL_INFO>::iterator it = SkillReferenceInfo.find(index);
+
+	if (it == SkillReferenceInfo.end())
+	{
+		return false;
+	}
+
+	(*lpInfo) = it->second;
+
+	return true;
+}
+
+static int SkillReferenceGetSkillDamage(int index)
+{
+	std::map<int, SKILL_INFO>::iterator it = SkillReferenceInfo.find(index);
+
+	return ((it == SkillReferenceInfo.end()) ? -1 : it->second.Damage);
+}
+
+static int SkillReferenceGetSkillType(int index)
+{
+	std::map<int, SKILL_INFO>::iterator it = SkillReferenceInfo.find(index);
+
+	return ((it == SkillReferenceInfo.end()) ? -1 : it->second.Type);
+}
+
+static bool SkillReferenceCheckSkillRadio(int index, int x, int y, int tx, int ty)
+{
+	SKILL_INFO SkillInfo;
+
+	if (SkillReferenceGetInfo(index, &SkillInfo) == 0 || SkillInfo.Radio == 0)
+	{
+		return false;
+	}
+
+	return ((int)sqrt(pow((float)(x - tx), 2) + pow((float)(y - ty), 2)) <= SkillInfo.Radio);
+}
+
+TEST_CASE(SkillManager)
+{
+	SkillReferenceInfo.clear();
+
+	for (int n = 0; n < MAX_SKILL; n++)
+	{
+		if (gSkillManager.m_SkillInfo[n].Index == n)
+		{
+			SkillReferenceInfo.insert(std::pair<int, SKILL_INFO>(n, gSkillManager.m_SkillInfo[n]));
+		}
+	}
+
+	TEST_CHECK(SkillReferenceInfo.empty() == 0);
+
+	for (int n = -8; n < (MAX_SKILL + 8); n++)
+	{
+		SKILL_INFO SkillInfo;
+
+		TEST_CHECK((gSkillManager.GetInfo(n) != 0) == SkillReferenceGetInfo(n, &SkillInfo));
+
+		TEST_CHECK(gSkillManager.GetSkillDamage(n) == SkillReferenceGetSkillDamage(n));
+
+		TEST_CHECK(gSkillManager.GetSkillType(n) == SkillReferenceGetSkillType(n));
+
+		for (int i = 0; i < 12; i++)
+		{
+			TEST_CHECK(gSkillManager.CheckSkillRadio(n, 100, 100, (100 + i), (100 + (i / 2))) == SkillReferenceCheckSkillRadio(n, 100, 100, (100 + i), (100 + (i / 2))));
+		}
+	}
+
+	// Per-packet cost of the CGMultiSkillAttackRecv lookups for a skill
+	// hitting five targets: the class and mana checks once, then radius,
+	// damage and type for every target.
+
+	int aIndex = OBJECT_START_USER;
+
+	gObjAllocData(aIndex);
+
+	LPOBJ lpObj = &gObj[aIndex];
+
+	gObjSetInventory1Pointer(lpObj);
+
+	gObjCharZeroSet(aIndex);
+
+	lpObj->Type = OBJECT_USER;
+
+	lpObj->Connected = OBJECT_ONLINE;
+
+	lpObj->Socket = INVALID_SOCKET;
+
+	lpObj->Class = CLASS_DW;
+
+	lpObj->ChangeUp = 1;
+
+	lpObj->Mana = 1000;
+
+	lpObj->X = 100;
+
+	lpObj->Y = 100;
+
+	static const int SkillList[8] = {SKILL_FLAME, SKILL_TWISTER, SKILL_EVIL_SPIRIT, SKILL_HELL_FIRE, SKILL_AQUA_BEAM, SKILL_INFERNO, SKILL_TWISTING_SLASH, SKILL_DEATH_STAB};
+
+	const int count = 1000000;
+
+	volatile int sink = 0;
+
+	std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+	for (int n = 0; n < count; n++)
+	{
+		int skill = SkillList[n & 7];
+
+		SKILL_INFO SkillInfo;
+
+		sink += SkillReferenceGetInfo(skill, &SkillInfo);
+
+		sink += SkillReferenceGetInfo(skill, &SkillInfo);
+
+		for (int i = 0; i < 5; i++)
+		{
+			sink += SkillReferenceCheckSkillRadio(skill, 100, 100, (100 + i), 101);
+
+			sink += SkillReferenceGetSkillDamage(skill);
+
+			sink += SkillReferenceGetSkillType(skill);
+		}
+	}
+
+	std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+	for (int n = 0; n < count; n++)
+	{
+		int skill = SkillList[n & 7];
+
+		sink += gSkillManager.CheckSkillRequireClass(lpObj, skill);
+
+		sink += gSkillManager.CheckSkillMana(lpObj, skill);
+
+		for (int i = 0; i < 5; i++)
+		{
+			sink += gSkillManager.CheckSkillRadio(skill, 100, 100, (100 + i), 101);
+
+			sink += gSkillManager.GetSkillDamage(skill);
+
+			sink += gSkillManager.GetSkillType(skill);
+		}
+	}
+
+	std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+	printf("MultiSkillAttack lookups (17 per packet): map %.1f ns, table %.1f ns\n", (std::chrono::duration<double, std::nano>(t1 - t0).count() / count), (std::chrono::duration<double, std::nano>(t2 - t1).count() / count));
+
+	return true;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#define MAX_TEST 32
+
+typedef bool(*TEST_FUNCTION)();
+
+struct TEST_INFO
+{
+	const char* Name;
+	TEST_FUNCTION Function;
+};
+
+class CTestRegister
+{
+public:
+
+	CTestRegister(const char* name, TEST_FUNCTION function);
+};
+
+void TestFail(const char* file, int line, const char* message, ...);
+
+#define TEST_CASE(name) static bool Test##name(); static CTestRegister TestRegister##name(#name, Test##name); static bool Test##name()
+
+#define TEST_CHECK(x) if (!(x)) { TestFail(__FILE__, __LINE__, "%s", #x); return false; }
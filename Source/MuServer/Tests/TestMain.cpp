@@ -0,0 +1,81 @@
+#include "stdafx.h"
+#include "Test.h"
+#include "GameMain.h"
+#include "ServerDisplayer.h"
+#include "ServerInfo.h"
+#include "Util.h"
+
+TEST_INFO gTestInfo[MAX_TEST];
+
+int gTestCount = 0;
+
+CTestRegister::CTestRegister(const char* name, TEST_FUNCTION function)
+{
+	if (gTestCount >= MAX_TEST)
+	{
+		return;
+	}
+
+	gTestInfo[gTestCount].Name = name;
+
+	gTestInfo[gTestCount].Function = function;
+
+	gTestCount++;
+}
+
+void TestFail(const char* file, int line, const char* message, ...)
+{
+	char buff[1024];
+
+	va_list arg;
+
+	va_start(arg, message);
+
+	vsnprintf(buff, sizeof(buff), message, arg);
+
+	va_end(arg);
+
+	printf("%s:%d: check failed: %s\n", file, line, buff);
+}
+
+int main(int argc, char** argv)
+{
+	setlocale(LC_ALL, "C");
+
+	SetLargeRand();
+
+	gServerInfo.ReadStartupInfo("GameServerInfo", "./Data/GameServerInfo - StartUp.dat");
+
+	gServerDisplayer.Init(nullptr);
+
+	GameMainInit(nullptr);
+
+	int failed = 0;
+
+	int count = 0;
+
+	for (int n = 0; n < gTestCount; n++)
+	{
+		if (argc > 1 && strcmp(argv[1], gTestInfo[n].Name) != 0)
+		{
+			continue;
+		}
+
+		bool result = gTestInfo[n].Function();
+
+		printf("[%s] %s\n", ((result == false) ? "FAILED" : "PASSED"), gTestInfo[n].Name);
+
+		failed += ((result == false) ? 1 : 0);
+
+		count++;
+	}
+
+	if (count == 0)
+	{
+		printf("no test matched\n");
+
+		return 1;
+	}
+
+	return ((failed == 0) ? 0 : 1);
+}